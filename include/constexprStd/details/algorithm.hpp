@@ -24,10 +24,15 @@
 #ifndef CONSTEXPRSTD_DETAILS_ALGORITHM_HPP
 #define CONSTEXPRSTD_DETAILS_ALGORITHM_HPP
 
+#include <cstddef>
+#include <functional>
+#include <limits>
 #include <type_traits>
+#include <utility>
 
 #include "../iterator"
 #include "algorithm_forward.hpp"
+#include "buffer.hpp"
 #include "find.hpp"
 #include "helper.hpp"
 
@@ -79,26 +84,39 @@ constexpr bool equalImpl(IterT1 first1, const IterT1 last1, IterT2 first2, const
 	return first1 == last1 && first2 == last2;
 }
 
+/**
+ * @brief The find_end for forward iterators, a single pass which remembers the last match.
+ */
 template<typename ForwardIter1, typename ForwardIter2, typename BinaryPredicate,
          std::enable_if_t<std::negation_v<IsRaIter<ForwardIter1>>>* = nullptr>
-constexpr ForwardIter1 findEndImpl(const ForwardIter1 first, const ForwardIter1 last,
+constexpr ForwardIter1 findEndImpl(ForwardIter1 first, const ForwardIter1 last,
                                    const ForwardIter2 s_first, const ForwardIter2 s_last, BinaryPredicate pred)
 		noexcept(noexcept(s_first == s_last) && std::is_nothrow_copy_constructible_v<ForwardIter1> &&
-		         std::is_nothrow_copy_assignable_v<ForwardIter1> && std::is_nothrow_move_assignable_v<ForwardIter1> &&
-		         noexcept(constexprStd::search(first, last, s_first, s_last, pred)) &&
-		         noexcept(std::declval<ForwardIter1&>() != last)) {
+		         std::is_nothrow_copy_constructible_v<ForwardIter2> && std::is_nothrow_copy_assignable_v<ForwardIter1> &&
+		         noexcept(first != last && std::declval<ForwardIter2&>() != s_last &&
+		                  pred(*first, *std::declval<ForwardIter2&>())) &&
+		         noexcept(++first, ++std::declval<ForwardIter2&>()) &&
+		         noexcept(std::declval<ForwardIter2&>() == s_last) && noexcept(first == last)) {
 	if ( s_first == s_last ) {
 		return last;
 	} //if ( s_first == s_last )
 	
-	auto ret = constexprStd::search(first, last, s_first, s_last, pred);
-	if ( ret != last ) {
-		auto match = ret;
-		do { //while ( match != last )
-			ret = match;
-			match = constexprStd::search(constexprStd::next(match), last, s_first, s_last, pred);
-		} while ( match != last );
-	} //if ( ret != last )
+	ForwardIter1 ret = last;
+	for ( ; first != last; ++first ) {
+		auto scan = first;
+		auto cmp  = s_first;
+		for ( ; scan != last && cmp != s_last && pred(*scan, *cmp); ++scan, ++cmp ) {
+			
+		} //for ( ; scan != last && cmp != s_last && pred(*scan, *cmp); ++scan, ++cmp )
+		
+		if ( cmp == s_last ) {
+			ret = first;
+		} //if ( cmp == s_last )
+		else if ( scan == last ) {
+			//The rest is shorter than the pattern
+			break;
+		} //else if ( scan == last )
+	} //for ( ; first != last; ++first )
 	return ret;
 }
 
@@ -115,7 +133,10 @@ constexpr RandomAccessIter1 findEndImpl(const RandomAccessIter1 first, const Ran
 		         std::is_nothrow_copy_constructible_v<RandomAccessIter2> &&
 		         noexcept(s_first != s_last) &&
 		         noexcept(++std::declval<RandomAccessIter2&>(), ++std::declval<RandomAccessIter1&>()) &&
-		         noexcept(!pred(*first, *s_first))) {
+		         noexcept(!pred(*first, *s_first)) &&
+		         std::disjunction_v<std::negation<IsOrderedSearch<RandomAccessIter1, RandomAccessIter2, BinaryPredicate>>,
+		                            IsNothrowLessComparable<
+		                            	typename std::iterator_traits<RandomAccessIter1>::value_type>>) {
 	if ( s_first == s_last ) {
 		return last;
 	} //if ( s_first == s_last )
@@ -127,6 +148,17 @@ constexpr RandomAccessIter1 findEndImpl(const RandomAccessIter1 first, const Ran
 		return last;
 	} //if ( sDistance > distance )
 	
+	if constexpr ( IsOrderedSearch<RandomAccessIter1, RandomAccessIter2, BinaryPredicate>::value ) {
+		//Horspool on the reversed ranges, the first match there is the last one
+		using RevIter1 = std::reverse_iterator<RandomAccessIter1>;
+		using RevIter2 = std::reverse_iterator<RandomAccessIter2>;
+		const RevIter1 rfirst{last}, rlast{first};
+		const RevIter2 patFirst{s_last};
+		const HorspoolTable<RevIter2> table{patFirst, sDistance};
+		const RevIter1 match = horspoolSearch(rfirst, rlast, patFirst, sDistance, table, pred);
+		return match == rlast ? last : constexprStd::next(match.base(), -sDistance);
+	} //if constexpr ( IsOrderedSearch<RandomAccessIter1, RandomAccessIter2, BinaryPredicate>::value )
+	
 	for ( auto dist = distance - sDistance; dist >= 0; --dist ) {
 		auto iter = constexprStd::next(first, dist);
 		auto ret  = iter;
@@ -143,6 +175,95 @@ constexpr RandomAccessIter1 findEndImpl(const RandomAccessIter1 first, const Ran
 	return last;
 }
 
+template<typename ForwardIter, typename Count, typename T, typename BinaryPredicate,
+         std::enable_if_t<std::negation_v<IsRaIter<ForwardIter>>>* = nullptr>
+constexpr ForwardIter searchNImpl(ForwardIter first, const ForwardIter last, const Count count, const T& value,
+                                  BinaryPredicate& pred)
+		noexcept(noexcept(first != last) && std::is_nothrow_copy_constructible_v<ForwardIter> &&
+		         std::is_nothrow_constructible_v<Count, int> &&
+		         noexcept(std::declval<Count&>() < count && first != last) &&
+		         noexcept(++std::declval<Count&>(), ++first) && noexcept(!pred(*first, value)) &&
+		         noexcept(std::declval<Count&>() == count) && noexcept(++first) &&
+		         std::is_nothrow_copy_assignable_v<ForwardIter> && noexcept(count <= 0)) {
+	if ( count <= 0 ) {
+		return first;
+	} //if ( count <= 0 )
+	
+	while ( first != last ) {
+		auto scan = first;
+		Count i = 0;
+		for ( ; i < count && scan != last; ++i, ++scan ) {
+			if ( !pred(*scan, value) ) {
+				break;
+			} //if ( !pred(*scan, value) )
+		} //for ( ; i < count && scan != last; ++i, ++scan )
+		
+		if ( i == count ) {
+			return first;
+		} //if ( i == count )
+		
+		if ( scan == last ) {
+			return last;
+		} //if ( scan == last )
+		
+		first = ++scan;
+	} //while ( first != last )
+	return last;
+}
+
+/**
+ * @brief The search_n for random access iterators, which only probes every count-th element.
+ *
+ * No run can start before start, so a run starting there or later has to contain the element start + count - 1. If
+ * that probe matches we extend it backwards to find the begin of the run and then verify it forwards. After a mismatch
+ * the search continues behind it, so every element is inspected at most once and on mismatches most are skipped.
+ */
+template<typename RandomAccessIter, typename Count, typename T, typename BinaryPredicate,
+         std::enable_if_t<IsRaIter<RandomAccessIter>::value>* = nullptr>
+constexpr RandomAccessIter searchNImpl(const RandomAccessIter first, const RandomAccessIter last, const Count count,
+                                       const T& value, BinaryPredicate& pred)
+		noexcept(noexcept(count <= 0) && noexcept(last - first) && noexcept(first + 1) &&
+		         noexcept(pred(first[0], value))) {
+	using DistType = typename std::iterator_traits<RandomAccessIter>::difference_type;
+	
+	if ( count <= 0 ) {
+		return first;
+	} //if ( count <= 0 )
+	
+	const DistType length = last - first;
+	const DistType n      = static_cast<DistType>(count);
+	
+	for ( DistType start = 0; length - start >= n; ) {
+		const DistType probe = start + n - 1;
+		if ( !pred(first[probe], value) ) {
+			start = probe + 1;
+			continue;
+		} //if ( !pred(first[probe], value) )
+		
+		//The element before start is a mismatch (or does not exist), so we do not have to look further back
+		DistType runStart = probe;
+		while ( runStart > start && pred(first[runStart - 1], value) ) {
+			--runStart;
+		} //while ( runStart > start && pred(first[runStart - 1], value) )
+		
+		const DistType runEnd = runStart + n;
+		if ( runEnd > length ) {
+			return last;
+		} //if ( runEnd > length )
+		
+		DistType scan = probe + 1;
+		while ( scan < runEnd && pred(first[scan], value) ) {
+			++scan;
+		} //while ( scan < runEnd && pred(first[scan], value) )
+		
+		if ( scan == runEnd ) {
+			return first + runStart;
+		} //if ( scan == runEnd )
+		start = scan + 1;
+	} //for ( DistType start = 0; length - start >= n; )
+	return last;
+}
+
 template<typename T>
 constexpr void threeSwap(T& one, T& two, T& three)
 		noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>) {
@@ -275,45 +396,169 @@ noexcept(std::is_nothrow_move_constructible_v<ForwardIter> &&
 	return ret;
 }
 
-template<typename BidirIter>
-constexpr void rotateOneRight(const BidirIter first, BidirIter last)
-noexcept {
-	auto beforeLast = constexprStd::prev(last);
-	auto temp = std::move(*beforeLast);
-	constexprStd::move_backward(first, beforeLast, last);
-	*first = std::move(temp);
-	return;
+/**
+ * @brief Partitions [first, last) stable, pred is applied exactly once per element.
+ * @note The caller has to ensure that the range is not empty and pred(*first) is false.
+ *
+ * If the range fits into the buffer, the false elements are moved there and back behind the true ones in linear time.
+ * Otherwise both halves are partitioned recursively and the false part of the left half is rotated behind the true part
+ * of the right half, which needs O(n log n) moves without any buffer.
+ */
+template<typename ForwardIter, typename UnaryPredicate, typename Dist>
+constexpr ForwardIter stablePartitionAdaptive(ForwardIter first, const ForwardIter last, UnaryPredicate& pred,
+                                              const Dist len, typeOf<ForwardIter> *const buffer, const Dist bufferSize)
+		noexcept(noexcept(pred(*first)) && noexcept(++first) && noexcept(first != last) &&
+		         noexcept(constexprStd::next(first, len)) && noexcept(constexprStd::rotate(first, first, last)) &&
+		         std::is_nothrow_move_assignable_v<typeOf<ForwardIter>>) {
+	if ( len == 1 ) {
+		return first;
+	} //if ( len == 1 )
+	
+	//Implied by len >= 1, but spelled out so the compiler sees the possibly null empty buffer is never written
+	if ( bufferSize > 0 && len <= bufferSize ) {
+		auto trueIter = first;
+		auto bufferIter = buffer;
+		*bufferIter = std::move(*first);
+		for ( ++bufferIter, ++first; first != last; ++first ) {
+			if ( pred(*first) ) {
+				*trueIter = std::move(*first);
+				++trueIter;
+			} //if ( pred(*first) )
+			else {
+				*bufferIter = std::move(*first);
+				++bufferIter;
+			} //else -> if ( pred(*first) )
+		} //for ( ++bufferIter, ++first; first != last; ++first )
+		constexprStd::move(buffer, bufferIter, trueIter);
+		return trueIter;
+	} //if ( bufferSize > 0 && len <= bufferSize )
+	
+	const Dist leftLen = len / 2;
+	const auto middle = constexprStd::next(first, leftLen);
+	const auto leftSplit = stablePartitionAdaptive(first, middle, pred, leftLen, buffer, bufferSize);
+	
+	//Skip the leading true elements of the right half, to fulfill our own precondition
+	Dist rightLen = len - leftLen;
+	auto rightSplit = middle;
+	for ( ; rightLen != 0 && pred(*rightSplit); --rightLen ) {
+		++rightSplit;
+	} //for ( ; rightLen != 0 && pred(*rightSplit); --rightLen )
+	
+	if ( rightLen != 0 ) {
+		rightSplit = stablePartitionAdaptive(rightSplit, last, pred, rightLen, buffer, bufferSize);
+	} //if ( rightLen != 0 )
+	return constexprStd::rotate(leftSplit, middle, rightSplit);
+}
+
+template<typename ForwardIter, typename UnaryPredicate, typename Dist>
+ForwardIter stablePartitionBuffered(const ForwardIter first, const ForwardIter last, UnaryPredicate& pred,
+                                    const Dist len)
+		noexcept(noexcept(stablePartitionAdaptive(first, last, pred, len, std::declval<typeOf<ForwardIter>*>(), len))) {
+	TemporaryBuffer<typeOf<ForwardIter>> buffer{first, len};
+	return stablePartitionAdaptive(first, last, pred, len, buffer.begin(), static_cast<Dist>(buffer.size()));
 }
 
+/**
+ * @brief The binary search for random access iterators.
+ *
+ * Instead of shrinking the range from both sides, we only keep the begin and the length and halve the length in every
+ * step, regardless of the result of pred. So the loop runs always the same number of times and the only data
+ * dependent operation is the selection of the new begin, which the compiler can do with a conditional move instead of
+ * a branch which would be mispredicted half of the time.
+ */
 template<typename RandomAccessIter, typename UnaryPredicate>
-constexpr RandomAccessIter partitionPointImpl(RandomAccessIter first, RandomAccessIter last, UnaryPredicate pred,
-                                              const std::random_access_iterator_tag)
-		noexcept(noexcept(first != last) && noexcept(constexprStd::distance(first, last)) &&
-		         std::is_nothrow_move_constructible_v<typename
+constexpr RandomAccessIter partitionPointImpl(RandomAccessIter first, const RandomAccessIter last,
+                                              UnaryPredicate pred, const std::random_access_iterator_tag)
+		noexcept(noexcept(constexprStd::distance(first, last)) &&
+		         std::is_nothrow_copy_constructible_v<typename
 		                                              std::iterator_traits<RandomAccessIter>::difference_type> &&
-		         noexcept(std::declval<typename std::iterator_traits<RandomAccessIter>::difference_type&>() / 2) &&
-		         noexcept(constexprStd::next(first)) && std::is_nothrow_move_constructible_v<RandomAccessIter> &&
-		         noexcept(pred(*first)) && noexcept(++first) && std::is_nothrow_copy_assignable_v<RandomAccessIter>) {
-	while ( first != last ) {
-		const auto dist = constexprStd::distance(first, last);
-		const auto incr = dist / 2;
-		auto middle = constexprStd::next(first, incr);
+		         noexcept(pred(first[1])) && noexcept(first += 1) && noexcept(pred(*first))) {
+	auto len = constexprStd::distance(first, last);
+	while ( len > 1 ) {
+		const auto half = len / 2;
+		first += pred(first[half]) ? half : 0;
+		len   -= half;
+	} //while ( len > 1 )
+	
+	if ( len == 1 && pred(*first) ) {
+		++first;
+	} //if ( len == 1 && pred(*first) )
+	return first;
+}
+
+template<typename ForwardIter, typename UnaryPredicate>
+constexpr ForwardIter partitionPointImpl(ForwardIter first, const ForwardIter last, UnaryPredicate pred,
+                                         const std::forward_iterator_tag)
+		noexcept(noexcept(constexprStd::distance(first, last)) && noexcept(constexprStd::next(first, 1)) &&
+		         std::is_nothrow_copy_assignable_v<ForwardIter> && noexcept(pred(*first)) && noexcept(++first)) {
+	auto len = constexprStd::distance(first, last);
+	while ( len > 0 ) {
+		const auto half = len / 2;
+		auto middle = constexprStd::next(first, half);
 		
 		if ( pred(*middle) ) {
 			first = ++middle;
+			len  -= half + 1;
 		} //if ( pred(*middle) )
 		else {
-			last = middle;
+			len = half;
 		} //else -> if ( pred(*middle) )
-	} //while ( first != last )
-	return last;
+	} //while ( len > 0 )
+	return first;
 }
 
-template<typename ForwardIter, typename UnaryPredicate>
-constexpr ForwardIter partitionPointImpl(ForwardIter first, ForwardIter last, UnaryPredicate pred,
-                                         const std::forward_iterator_tag)
-		noexcept(noexcept(constexprStd::find_if_not(first, last, std::move(pred)))) {
-	return constexprStd::find_if_not(first, last, std::move(pred));
+/**
+ * @brief Returns the first element in [first, last) for which pred is false, pred(*first) has to be true.
+ *
+ * This is an exponential search: we probe the elements 1, 3, 7, 15, ... until we overshoot and then search the last
+ * interval binary. So skipping k elements costs O(log k) calls of pred, instead of O(k) for the linear search.
+ */
+template<typename RandomAccessIter, typename UnaryPredicate>
+constexpr RandomAccessIter gallop(const RandomAccessIter first, const RandomAccessIter last, UnaryPredicate pred,
+                                  const std::random_access_iterator_tag)
+		noexcept(noexcept(constexprStd::distance(first, last)) && noexcept(pred(first[1])) &&
+		         noexcept(partitionPointImpl(first + 1, first + 1, pred, std::random_access_iterator_tag{}))) {
+	const auto len = constexprStd::distance(first, last);
+	decltype(constexprStd::distance(first, last)) low = 0, high = 1;
+	
+	while ( high < len && pred(first[high]) ) {
+		low  = high;
+		high = high < (len - 1) / 2 ? 2 * high + 1 : len;
+	} //while ( high < len && pred(first[high]) )
+	return partitionPointImpl(first + low + 1, first + high, std::move(pred), std::random_access_iterator_tag{});
+}
+
+template<typename InputIter, typename UnaryPredicate>
+constexpr InputIter gallop(InputIter first, const InputIter last, UnaryPredicate pred, const std::input_iterator_tag)
+		noexcept(noexcept(constexprStd::find_if_not(++first, last, std::move(pred)))) {
+	return constexprStd::find_if_not(++first, last, std::move(pred));
+}
+
+/**
+ * @brief Copies all elements less than value from first to d_first and advances both, cmp(*first, value) has to be
+ *        true.
+ */
+template<typename ForwardIter, typename T, typename OutputIter, typename Compare>
+constexpr void copyLessThan(ForwardIter& first, const ForwardIter last, const T& value, OutputIter& d_first,
+                            Compare& cmp, const std::forward_iterator_tag)
+		noexcept(noexcept(gallop(first, last, cmp::LessThanValue{cmp, value}, iteratorCategory<ForwardIter>)) &&
+		         noexcept(d_first = constexprStd::copy(first, first, d_first)) &&
+		         std::is_nothrow_copy_assignable_v<ForwardIter>) {
+	const auto runEnd = gallop(first, last, cmp::LessThanValue{cmp, value}, iteratorCategory<ForwardIter>);
+	d_first = constexprStd::copy(first, runEnd, d_first);
+	first = runEnd;
+	return;
+}
+
+template<typename InputIter, typename T, typename OutputIter, typename Compare>
+constexpr void copyLessThan(InputIter& first, const InputIter, const T&, OutputIter& d_first, Compare&,
+                            const std::input_iterator_tag)
+		noexcept(noexcept(*d_first = *first) && noexcept(++d_first) && noexcept(++first)) {
+	//We can not look ahead and then copy, so we copy just the one element we know about
+	*d_first = *first;
+	++d_first;
+	++first;
+	return;
 }
 
 template<typename RandIter, typename Compare,
@@ -376,6 +621,632 @@ constexpr RandIter partitionByElement(RandIter first, const RandIter end, Compar
 	} //if ( cmp(*end, *first) )
 	return first;
 }
+
+template<typename BidirIter, typename Compare>
+constexpr void insertionSort(const BidirIter first, const BidirIter last, Compare& cmp)
+		noexcept(noexcept(first == last) && noexcept(constexprStd::next(first)) && noexcept(first != last) &&
+		         noexcept(++std::declval<BidirIter&>(), --std::declval<BidirIter&>()) &&
+		         noexcept(cmp(*first, *first)) && std::is_nothrow_move_constructible_v<typeOf<BidirIter>> &&
+		         std::is_nothrow_move_assignable_v<typeOf<BidirIter>>) {
+	if ( first == last ) {
+		return;
+	} //if ( first == last )
+	
+	for ( auto iter = constexprStd::next(first); iter != last; ++iter ) {
+		auto hole = iter;
+		auto prev = constexprStd::prev(hole);
+		if ( cmp(*iter, *prev) ) {
+			auto temp = std::move(*iter);
+			do { //while ( hole != first && cmp(temp, *--prev) )
+				*hole = std::move(*prev);
+				--hole;
+			} while ( hole != first && cmp(temp, *--prev) );
+			*hole = std::move(temp);
+		} //if ( cmp(*iter, *prev) )
+	} //for ( auto iter = constexprStd::next(first); iter != last; ++iter )
+	return;
+}
+
+/**
+ * @brief Like insertionSort, but gives up after a few moved elements.
+ * @return If the range is sorted. If not it is still a permutation of the input.
+ */
+template<typename RandIter, typename Compare>
+constexpr bool partialInsertionSort(const RandIter first, const RandIter last, Compare& cmp)
+		noexcept(noexcept(insertionSort(first, last, cmp)) && noexcept(constexprStd::distance(first, last))) {
+	constexpr auto moveLimit = 8;
+	auto moves = decltype(constexprStd::distance(first, last)){0};
+	
+	if ( first == last ) {
+		return true;
+	} //if ( first == last )
+	
+	for ( auto iter = constexprStd::next(first); iter != last; ++iter ) {
+		auto hole = iter;
+		auto prev = constexprStd::prev(hole);
+		if ( cmp(*iter, *prev) ) {
+			auto temp = std::move(*iter);
+			do { //while ( hole != first && cmp(temp, *--prev) )
+				*hole = std::move(*prev);
+				--hole;
+			} while ( hole != first && cmp(temp, *--prev) );
+			*hole = std::move(temp);
+			
+			moves += constexprStd::distance(hole, iter);
+			if ( moves > moveLimit ) {
+				return false;
+			} //if ( moves > moveLimit )
+		} //if ( cmp(*iter, *prev) )
+	} //for ( auto iter = constexprStd::next(first); iter != last; ++iter )
+	return true;
+}
+
+/**
+ * @brief Returns the depth limit for introSort on n elements: 2 * log2(n) levels of partitioning, before it switches to
+ *        heap sort.
+ */
+template<typename Dist>
+constexpr int introSortDepthLimit(Dist n) noexcept(noexcept(n > 1) && noexcept(n /= 2)) {
+	int depthLimit = 0;
+	for ( ; n > 1; n /= 2 ) {
+		depthLimit += 2;
+	} //for ( ; n > 1; n /= 2 )
+	return depthLimit;
+}
+
+template<typename RandIter, typename Compare,
+         typename Dist = typename std::iterator_traits<RandIter>::difference_type>
+constexpr void introSort(RandIter first, RandIter last, Compare& cmp, int depthLimit, bool leftmost)
+		noexcept(noexcept(constexprStd::distance(first, last)) && noexcept(insertionSort(first, last, cmp)) &&
+		         noexcept(partialInsertionSort(first, last, cmp)) && noexcept(constexprStd::reverse(first, last)) &&
+		         noexcept(constexprStd::make_heap(first, last, cmp)) &&
+		         noexcept(constexprStd::sort_heap(first, last, cmp)) &&
+		         noexcept(moveMedianOfThreeToEnd(first, last, cmp)) && noexcept(partitionByElement(first, last, cmp)) &&
+		         noexcept(partitionByElement(first, last, std::declval<cmp::NotGreater<Compare>&>()))) {
+	constexpr Dist insertionSortThreshold = 16;
+	
+	while ( true ) {
+		const Dist size = constexprStd::distance(first, last);
+		if ( size <= insertionSortThreshold ) {
+			insertionSort(first, last, cmp);
+			return;
+		} //if ( size <= insertionSortThreshold )
+		
+		if ( depthLimit == 0 ) {
+			//Too many bad partitions, fall back to the guaranteed O(n log n) of the heap sort
+			constexprStd::make_heap(first, last, cmp);
+			constexprStd::sort_heap(first, last, cmp);
+			return;
+		} //if ( depthLimit == 0 )
+		--depthLimit;
+		
+		//Look at the pivot candidates, if they are ordered the whole range may already be sorted
+		const auto middle = constexprStd::next(first, size / 2);
+		const auto back   = constexprStd::prev(last);
+		if ( !cmp(*middle, *first) && !cmp(*back, *middle) ) {
+			if ( partialInsertionSort(first, last, cmp) ) {
+				return;
+			} //if ( partialInsertionSort(first, last, cmp) )
+		} //if ( !cmp(*middle, *first) && !cmp(*back, *middle) )
+		else if ( cmp(*middle, *first) && cmp(*back, *middle) ) {
+			cmp::Flip flipped{cmp};
+			auto iter = constexprStd::next(first);
+			for ( ; iter != last && !flipped(*iter, *constexprStd::prev(iter)); ++iter ) {
+				
+			} //for ( ; iter != last && !flipped(*iter, *constexprStd::prev(iter)); ++iter )
+			
+			if ( iter == last ) {
+				constexprStd::reverse(first, last);
+				return;
+			} //if ( iter == last )
+		} //else if ( cmp(*middle, *first) && cmp(*back, *middle) )
+		
+		const auto end = moveMedianOfThreeToEnd(first, last, cmp);
+		
+		if ( !leftmost && !cmp(*constexprStd::prev(first), *end) ) {
+			/* The pivot is equal to the element before our range, which is the pivot of an earlier partition. So there
+			 * is no smaller element and we put all equal ones to the left, they are already at their final place. */
+			cmp::NotGreater notGreater{cmp};
+			first = constexprStd::next(partitionByElement(first, end, notGreater));
+			continue;
+		} //if ( !leftmost && !cmp(*constexprStd::prev(first), *end) )
+		
+		const auto cut = partitionByElement(first, end, cmp);
+		
+		//Recurse into the smaller part, so we never need more than log(n) stack frames
+		if ( constexprStd::distance(first, cut) < constexprStd::distance(cut, last) ) {
+			introSort(first, cut, cmp, depthLimit, leftmost);
+			first    = constexprStd::next(cut);
+			leftmost = false;
+		} //if ( constexprStd::distance(first, cut) < constexprStd::distance(cut, last) )
+		else {
+			introSort(constexprStd::next(cut), last, cmp, depthLimit, false);
+			last = cut;
+		} //else -> if ( constexprStd::distance(first, cut) < constexprStd::distance(cut, last) )
+	} //while ( true )
+}
+
+/**
+ * @brief Moves the element which belongs to nth in the sorted range there, with all smaller ones before it.
+ */
+template<typename RandIter, typename Compare>
+constexpr void quickSelect(RandIter first, const RandIter nth, RandIter last, Compare& cmp)
+		noexcept(noexcept(first != last) && noexcept(moveMedianOfThreeToEnd(first, last, cmp)) &&
+		         std::is_nothrow_move_constructible_v<RandIter> && noexcept(partitionByElement(first, first, cmp)) &&
+		         noexcept(first == nth) && noexcept(first < nth) && std::is_nothrow_copy_assignable_v<RandIter> &&
+		         noexcept(++first)) {
+	while ( first != last ) {
+		auto end = moveMedianOfThreeToEnd(first, last, cmp);
+		auto cut = partitionByElement(first, end, cmp);
+		
+		if ( cut == nth ) {
+			return;
+		} //if ( cut == nth )
+		
+		if ( cut < nth ) {
+			first = ++cut;
+		} //if ( cut < nth )
+		else {
+			last = cut;
+		} //else -> if ( cut < nth )
+	} //while ( first != last )
+	return;
+}
+
+/**
+ * @brief The number of elements is_permutation sorts at once in a constant expression.
+ */
+constexpr inline std::ptrdiff_t PermutationChunkSize = 512;
+
+/**
+ * @brief Checks if the equally long ranges of ordered elements are permutations, without any allocation.
+ *
+ * The elements are handled in rounds, each takes the chunk of the smallest elements of the first range which are
+ * greater than the ones of the rounds before. They are collected in a buffer for two chunks, which is reduced to the
+ * smaller half with quickSelect whenever it is full, so a round is linear. The elements of the second range in the same
+ * interval are collected, both chunks are sorted and compared. Because all elements less than the maximum of the chunk
+ * are in it, only that maximum can have more copies than fit and is counted. Every round handles a full chunk, so this
+ * is O(n² / PermutationChunkSize) instead of O(n²).
+ */
+template<typename ForwardIter1, typename ForwardIter2>
+constexpr bool isPermutationChunked(const ForwardIter1 first1, const ForwardIter1 last1,
+                                    const ForwardIter2 first2, const ForwardIter2 last2)
+		noexcept(IsNothrowLessComparable<typename std::iterator_traits<ForwardIter1>::value_type>::value &&
+		         noexcept(std::declval<ForwardIter1&>() != last1) && noexcept(++std::declval<ForwardIter1&>()) &&
+		         noexcept(std::declval<ForwardIter2&>() != last2) && noexcept(++std::declval<ForwardIter2&>()) &&
+		         std::is_nothrow_copy_assignable_v<ForwardIter1> && std::is_nothrow_copy_assignable_v<ForwardIter2>) {
+	std::less<> less;
+	cmp::Indirect indirect{less};
+	
+	ForwardIter1 chunk1[2 * PermutationChunkSize] = {};
+	ForwardIter2 chunk2[PermutationChunkSize] = {};
+	ForwardIter1 low{};
+	bool haveLow = false;
+	
+	while ( true ) {
+		std::ptrdiff_t size1 = 0;
+		ForwardIter1 cut{};
+		bool haveCut = false;
+		for ( auto iter = first1; iter != last1; ++iter ) {
+			if ( (haveLow && !(*low < *iter)) || (haveCut && !(*iter < *cut)) ) {
+				continue;
+			} //if ( (haveLow && !(*low < *iter)) || (haveCut && !(*iter < *cut)) )
+			
+			chunk1[size1++] = iter;
+			if ( size1 == 2 * PermutationChunkSize ) {
+				//Keep the smaller half, nothing which is not less than its greatest element is needed in this round
+				quickSelect(chunk1, chunk1 + PermutationChunkSize - 1, chunk1 + size1, indirect);
+				size1   = PermutationChunkSize;
+				cut     = chunk1[PermutationChunkSize - 1];
+				haveCut = true;
+			} //if ( size1 == 2 * PermutationChunkSize )
+		} //for ( auto iter = first1; iter != last1; ++iter )
+		
+		if ( size1 == 0 ) {
+			//Both ranges have the same length and all elements of the first one are matched
+			return true;
+		} //if ( size1 == 0 )
+		
+		if ( size1 > PermutationChunkSize ) {
+			quickSelect(chunk1, chunk1 + PermutationChunkSize - 1, chunk1 + size1, indirect);
+			size1 = PermutationChunkSize;
+		} //if ( size1 > PermutationChunkSize )
+		
+		introSort(chunk1, chunk1 + size1, indirect, introSortDepthLimit(size1), true);
+		const ForwardIter1 high = chunk1[size1 - 1];
+		std::ptrdiff_t below = size1;
+		while ( below > 0 && !(*chunk1[below - 1] < *high) ) {
+			--below;
+		} //while ( below > 0 && !(*chunk1[below - 1] < *high) )
+		
+		std::ptrdiff_t highCount = 0, size2 = 0;
+		for ( auto iter = first1; iter != last1; ++iter ) {
+			if ( !(*iter < *high) && !(*high < *iter) ) {
+				++highCount;
+			} //if ( !(*iter < *high) && !(*high < *iter) )
+		} //for ( auto iter = first1; iter != last1; ++iter )
+		
+		for ( auto iter = first2; iter != last2; ++iter ) {
+			if ( haveLow && !(*low < *iter) ) {
+				continue;
+			} //if ( haveLow && !(*low < *iter) )
+			
+			if ( *iter < *high ) {
+				if ( size2 == below ) {
+					return false;
+				} //if ( size2 == below )
+				chunk2[size2++] = iter;
+			} //if ( *iter < *high )
+			else if ( !(*high < *iter) ) {
+				--highCount;
+			} //else if ( !(*high < *iter) )
+		} //for ( auto iter = first2; iter != last2; ++iter )
+		
+		if ( size2 != below || highCount != 0 ) {
+			return false;
+		} //if ( size2 != below || highCount != 0 )
+		
+		introSort(chunk2, chunk2 + size2, indirect, introSortDepthLimit(size2), true);
+		for ( std::ptrdiff_t i = 0; i < below; ++i ) {
+			if ( *chunk1[i] < *chunk2[i] || *chunk2[i] < *chunk1[i] ) {
+				return false;
+			} //if ( *chunk1[i] < *chunk2[i] || *chunk2[i] < *chunk1[i] )
+		} //for ( std::ptrdiff_t i = 0; i < below; ++i )
+		
+		low     = high;
+		haveLow = true;
+	} //while ( true )
+}
+
+/**
+ * @brief Checks if the equally long ranges of ordered elements are permutations, by sorting iterators to them.
+ *
+ * This is the runtime variant, if the buffers for the iterators can not be allocated the chunked variant is used.
+ */
+template<typename ForwardIter1, typename ForwardIter2>
+bool isPermutationBuffered(const ForwardIter1 first1, const ForwardIter1 last1,
+                           const ForwardIter2 first2, const ForwardIter2 last2)
+		noexcept(noexcept(isPermutationChunked(first1, last1, first2, last2)) &&
+		         noexcept(constexprStd::distance(first1, last1))) {
+	const std::ptrdiff_t size = constexprStd::distance(first1, last1);
+	ForwardIter1 seed1 = first1;
+	ForwardIter2 seed2 = first2;
+	TemporaryBuffer<ForwardIter1> sorted1{&seed1, size};
+	TemporaryBuffer<ForwardIter2> sorted2{&seed2, size};
+	if ( sorted1.size() != size || sorted2.size() != size ) {
+		return isPermutationChunked(first1, last1, first2, last2);
+	} //if ( sorted1.size() != size || sorted2.size() != size )
+	
+	ForwardIter1 *out1 = sorted1.begin();
+	for ( auto iter = first1; iter != last1; ++iter ) {
+		*out1++ = iter;
+	} //for ( auto iter = first1; iter != last1; ++iter )
+	ForwardIter2 *out2 = sorted2.begin();
+	for ( auto iter = first2; iter != last2; ++iter ) {
+		*out2++ = iter;
+	} //for ( auto iter = first2; iter != last2; ++iter )
+	
+	std::less<> less;
+	cmp::Indirect indirect{less};
+	const int depthLimit = introSortDepthLimit(size);
+	introSort(sorted1.begin(), out1, indirect, depthLimit, true);
+	introSort(sorted2.begin(), out2, indirect, depthLimit, true);
+	
+	for ( std::ptrdiff_t i = 0; i < size; ++i ) {
+		const auto& value1 = *sorted1.begin()[i];
+		const auto& value2 = *sorted2.begin()[i];
+		if ( value1 < value2 || value2 < value1 ) {
+			return false;
+		} //if ( value1 < value2 || value2 < value1 )
+	} //for ( std::ptrdiff_t i = 0; i < size; ++i )
+	return true;
+}
+
+/**
+ * @brief Merges [first, middle) and [middle, last) stable.
+ *
+ * If one of the halves fits into the buffer, it is moved there and merged back in linear time. Otherwise we cut the
+ * larger half in two, search the cut position in the other half and rotate, so that we have two independent merges of
+ * smaller size. Without any buffer (like in constexpr context) this results in O(n log n) moves and O(n) comparisons.
+ * The buffer has to be constructed, e.g. by TemporaryBuffer.
+ */
+template<typename BidirIter, typename Dist, typename Compare>
+constexpr void mergeAdaptive(const BidirIter first, const BidirIter middle, const BidirIter last,
+                             const Dist len1, const Dist len2, typeOf<BidirIter> *const buffer, const Dist bufferSize,
+                             Compare& cmp)
+		noexcept(noexcept(cmp(*first, *first)) && std::is_nothrow_copy_constructible_v<BidirIter> &&
+		         noexcept(constexprStd::next(first, len1)) && noexcept(constexprStd::distance(first, last)) &&
+		         noexcept(++std::declval<BidirIter&>(), --std::declval<BidirIter&>()) &&
+		         noexcept(constexprStd::iter_swap(first, middle)) && noexcept(constexprStd::rotate(first, middle, last)) &&
+		         std::is_nothrow_move_assignable_v<typeOf<BidirIter>>) {
+	if ( len1 == 0 || len2 == 0 ) {
+		return;
+	} //if ( len1 == 0 || len2 == 0 )
+	
+	if ( len1 + len2 == 2 ) {
+		if ( cmp(*middle, *first) ) {
+			constexprStd::iter_swap(first, middle);
+		} //if ( cmp(*middle, *first) )
+		return;
+	} //if ( len1 + len2 == 2 )
+	
+	if ( len1 <= len2 && len1 <= bufferSize ) {
+		auto bufferIter = buffer;
+		const auto bufferEnd = constexprStd::move(first, middle, buffer);
+		auto out = first;
+		auto right = middle;
+		for ( ; bufferIter != bufferEnd && right != last; ++out ) {
+			if ( cmp(*right, *bufferIter) ) {
+				*out = std::move(*right);
+				++right;
+			} //if ( cmp(*right, *bufferIter) )
+			else {
+				*out = std::move(*bufferIter);
+				++bufferIter;
+			} //else -> if ( cmp(*right, *bufferIter) )
+		} //for ( ; bufferIter != bufferEnd && right != last; ++out )
+		constexprStd::move(bufferIter, bufferEnd, out);
+		return;
+	} //if ( len1 <= len2 && len1 <= bufferSize )
+	
+	if ( len2 <= bufferSize ) {
+		auto bufferIter = constexprStd::move(middle, last, buffer);
+		auto out = last;
+		auto left = middle;
+		while ( bufferIter != buffer && left != first ) {
+			if ( cmp(*(bufferIter - 1), *constexprStd::prev(left)) ) {
+				*--out = std::move(*--left);
+			} //if ( cmp(*(bufferIter - 1), *constexprStd::prev(left)) )
+			else {
+				*--out = std::move(*--bufferIter);
+			} //else -> if ( cmp(*(bufferIter - 1), *constexprStd::prev(left)) )
+		} //while ( bufferIter != buffer && left != first )
+		constexprStd::move_backward(buffer, bufferIter, out);
+		return;
+	} //if ( len2 <= bufferSize )
+	
+	BidirIter cut1 = first, cut2 = middle;
+	Dist len11 = 0, len22 = 0;
+	if ( len1 > len2 ) {
+		len11 = len1 / 2;
+		cut1  = constexprStd::next(first, len11);
+		cut2  = partitionPointImpl(middle, last, cmp::LessThanValue{cmp, *cut1}, iteratorCategory<BidirIter>);
+		len22 = constexprStd::distance(middle, cut2);
+	} //if ( len1 > len2 )
+	else {
+		len22 = len2 / 2;
+		cut2  = constexprStd::next(middle, len22);
+		cut1  = partitionPointImpl(first, middle, cmp::NotGreaterThanValue{cmp, *cut2}, iteratorCategory<BidirIter>);
+		len11 = constexprStd::distance(first, cut1);
+	} //else -> if ( len1 > len2 )
+	
+	const auto newMiddle = constexprStd::rotate(cut1, middle, cut2);
+	mergeAdaptive(first, cut1, newMiddle, len11, len22, buffer, bufferSize, cmp);
+	mergeAdaptive(newMiddle, cut2, last, len1 - len11, len2 - len22, buffer, bufferSize, cmp);
+	return;
+}
+
+template<typename BidirIter, typename Dist, typename Compare>
+void inplaceMergeBuffered(const BidirIter first, const BidirIter middle, const BidirIter last,
+                          const Dist len1, const Dist len2, Compare& cmp)
+		noexcept(noexcept(mergeAdaptive(first, middle, last, len1, len2, std::declval<typeOf<BidirIter>*>(), len1, cmp))) {
+	if ( len1 == 0 || len2 == 0 ) {
+		return;
+	} //if ( len1 == 0 || len2 == 0 )
+	
+	TemporaryBuffer<typeOf<BidirIter>> buffer{first, len1 < len2 ? len1 : len2};
+	mergeAdaptive(first, middle, last, len1, len2, buffer.begin(), static_cast<Dist>(buffer.size()), cmp);
+	return;
+}
+
+/**
+ * @brief Returns the end of the run starting at first, a descending run is reversed.
+ * @note Only strictly descending runs are reversed, otherwise we would break the stability.
+ */
+template<typename RandIter, typename Compare>
+constexpr RandIter findRun(const RandIter first, const RandIter last, Compare& cmp)
+		noexcept(noexcept(constexprStd::next(first)) && noexcept(first != last) && noexcept(cmp(*first, *first)) &&
+		         noexcept(constexprStd::reverse(first, last))) {
+	auto runEnd = constexprStd::next(first);
+	if ( runEnd == last ) {
+		return runEnd;
+	} //if ( runEnd == last )
+	
+	if ( cmp(*runEnd, *first) ) {
+		for ( ++runEnd; runEnd != last && cmp(*runEnd, *constexprStd::prev(runEnd)); ++runEnd ) {
+			
+		} //for ( ++runEnd; runEnd != last && cmp(*runEnd, *constexprStd::prev(runEnd)); ++runEnd )
+		constexprStd::reverse(first, runEnd);
+	} //if ( cmp(*runEnd, *first) )
+	else {
+		for ( ++runEnd; runEnd != last && !cmp(*runEnd, *constexprStd::prev(runEnd)); ++runEnd ) {
+			
+		} //for ( ++runEnd; runEnd != last && !cmp(*runEnd, *constexprStd::prev(runEnd)); ++runEnd )
+	} //else -> if ( cmp(*runEnd, *first) )
+	return runEnd;
+}
+
+/**
+ * @brief A natural merge sort.
+ *
+ * The range is split in its existing (ascending or strictly descending) runs, short runs are extended with insertion
+ * sort. The runs are kept on a stack and merged, as soon as the second topmost run is not longer than twice the topmost
+ * run. This keeps the merges balanced and the stack small, and an already sorted range is done after one pass.
+ */
+template<typename RandIter, typename Compare, typename Dist = typename std::iterator_traits<RandIter>::difference_type>
+constexpr void stableSortImpl(const RandIter first, const RandIter last, Compare& cmp,
+                              typeOf<RandIter> *const buffer, const Dist bufferSize)
+		noexcept(noexcept(findRun(first, last, cmp)) && noexcept(insertionSort(first, last, cmp)) &&
+		         noexcept(mergeAdaptive(first, first, last, bufferSize, bufferSize, buffer, bufferSize, cmp))) {
+	constexpr Dist minRun = 16;
+	
+	//Every run on the stack is more than twice as long as the one above, so the stack never exceeds log2(n) runs
+	Dist runBegin[std::numeric_limits<Dist>::digits + 2] = {};
+	std::size_t runs = 0;
+	
+	const Dist size = constexprStd::distance(first, last);
+	
+	//The run i is [runBegin[i], runBegin[i + 1]), the topmost run ends at pos
+	auto runLength = [&runBegin,&runs](const std::size_t run, const Dist pos) constexpr noexcept {
+			return (run + 1 == runs ? pos : runBegin[run + 1]) - runBegin[run];
+		};
+	
+	auto mergeRuns = [&](const std::size_t run, const Dist pos) constexpr {
+			const Dist len1 = runLength(run, pos);
+			const Dist len2 = runLength(run + 1, pos);
+			const auto begin = constexprStd::next(first, runBegin[run]);
+			const auto middle = constexprStd::next(begin, len1);
+			mergeAdaptive(begin, middle, constexprStd::next(middle, len2), len1, len2, buffer, bufferSize, cmp);
+			
+			for ( auto i = run + 1; i + 1 < runs; ++i ) {
+				runBegin[i] = runBegin[i + 1];
+			} //for ( auto i = run + 1; i + 1 < runs; ++i )
+			--runs;
+			return;
+		};
+	
+	for ( Dist pos = 0; pos < size; ) {
+		const auto runStart = constexprStd::next(first, pos);
+		Dist runEnd = pos + constexprStd::distance(runStart, findRun(runStart, last, cmp));
+		
+		if ( runEnd - pos < minRun ) {
+			runEnd = size - pos < minRun ? size : pos + minRun;
+			insertionSort(runStart, constexprStd::next(first, runEnd), cmp);
+		} //if ( runEnd - pos < minRun )
+		
+		runBegin[runs++] = pos;
+		pos = runEnd;
+		
+		while ( runs >= 2 && runLength(runs - 2, pos) <= 2 * runLength(runs - 1, pos) ) {
+			if ( runs >= 3 && runLength(runs - 3, pos) < runLength(runs - 1, pos) ) {
+				mergeRuns(runs - 3, pos);
+			} //if ( runs >= 3 && runLength(runs - 3, pos) < runLength(runs - 1, pos) )
+			else {
+				mergeRuns(runs - 2, pos);
+			} //else -> if ( runs >= 3 && runLength(runs - 3, pos) < runLength(runs - 1, pos) )
+		} //while ( runs >= 2 && runLength(runs - 2, pos) <= 2 * runLength(runs - 1, pos) )
+	} //for ( Dist pos = 0; pos < size; )
+	
+	while ( runs >= 2 ) {
+		mergeRuns(runs - 2, size);
+	} //while ( runs >= 2 )
+	return;
+}
+
+template<typename RandIter, typename Compare>
+void stableSortBuffered(const RandIter first, const RandIter last, Compare& cmp)
+		noexcept(noexcept(stableSortImpl(first, last, cmp, std::declval<typeOf<RandIter>*>(),
+		                                 constexprStd::distance(first, last)))) {
+	const auto size = constexprStd::distance(first, last);
+	TemporaryBuffer<typeOf<RandIter>> buffer{first, (size + 1) / 2};
+	stableSortImpl(first, last, cmp, buffer.begin(), static_cast<decltype(size)>(buffer.size()));
+	return;
+}
+
+/**
+ * @brief If the min/max element search on Iter with Compare can be done by the vectorized runtime functions.
+ *
+ * Floating point types are excluded, with a NaN the lane wise reduction would not find the element of the sequential
+ * search.
+ */
+template<typename Iter, typename Compare, typename T = std::remove_cv_t<std::remove_pointer_t<Iter>>>
+constexpr inline bool CanVectorizeMinMax = std::is_pointer_v<Iter> && std::is_integral_v<T> &&
+                                           (std::is_same_v<Compare, std::less<>> ||
+                                            std::is_same_v<Compare, std::less<T>>);
+
+/**
+ * @brief Computes the minimal and maximal value of the non empty range [first, last).
+ *
+ * The values are computed in independent lanes which are only combined at the end, so the compiler can use vector
+ * instructions for the loop. Only usable at runtime.
+ */
+template<typename T>
+std::pair<T, T> minMaxValue(const T *first, const T *const last) noexcept {
+	constexpr std::ptrdiff_t lanes = sizeof(T) < 32 ? 32 / sizeof(T) : 1;
+	T mins[static_cast<std::size_t>(lanes)], maxs[static_cast<std::size_t>(lanes)];
+	for ( std::ptrdiff_t i = 0; i < lanes; ++i ) {
+		mins[i] = maxs[i] = *first;
+	} //for ( std::ptrdiff_t i = 0; i < lanes; ++i )
+	
+	for ( ; last - first >= lanes; first += lanes ) {
+		for ( std::ptrdiff_t i = 0; i < lanes; ++i ) {
+			mins[i] = first[i] < mins[i] ? first[i] : mins[i];
+			maxs[i] = maxs[i] < first[i] ? first[i] : maxs[i];
+		} //for ( std::ptrdiff_t i = 0; i < lanes; ++i )
+	} //for ( ; last - first >= lanes; first += lanes )
+	
+	for ( ; first != last; ++first ) {
+		mins[0] = *first < mins[0] ? *first : mins[0];
+		maxs[0] = maxs[0] < *first ? *first : maxs[0];
+	} //for ( ; first != last; ++first )
+	
+	for ( std::ptrdiff_t i = 1; i < lanes; ++i ) {
+		mins[0] = mins[i] < mins[0] ? mins[i] : mins[0];
+		maxs[0] = maxs[0] < maxs[i] ? maxs[i] : maxs[0];
+	} //for ( std::ptrdiff_t i = 1; i < lanes; ++i )
+	return {mins[0], maxs[0]};
+}
+
+/**
+ * @brief The runtime variant of min_element, max_element, and minmax_element for vectorizable ranges.
+ *
+ * After the values are known, we search the first minimum and the first (or last for minmax_element) maximum, as
+ * required by the standard.
+ */
+template<bool Min, bool Max, bool LastMax, typename T>
+std::pair<T*, T*> minMaxElementVectorized(T *const first, T *const last) noexcept {
+	if ( first == last ) {
+		return {last, last};
+	} //if ( first == last )
+	
+	const auto [minValue, maxValue] = minMaxValue(first, last);
+	T *minIter = last, *maxIter = last;
+	
+	if constexpr ( Min ) {
+		minIter = first;
+		while ( minValue < *minIter ) {
+			++minIter;
+		} //while ( minValue < *minIter )
+	} //if constexpr ( Min )
+	
+	if constexpr ( Max && LastMax ) {
+		maxIter = last - 1;
+		while ( *maxIter < maxValue ) {
+			--maxIter;
+		} //while ( *maxIter < maxValue )
+	} //if constexpr ( Max && LastMax )
+	else if constexpr ( Max ) {
+		maxIter = first;
+		while ( *maxIter < maxValue ) {
+			++maxIter;
+		} //while ( *maxIter < maxValue )
+	} //else if constexpr ( Max )
+	return {minIter, maxIter};
+}
+
+/**
+ * @brief Heap's algorithm, generates all permutations of [first, first + k) and calls f for each of them.
+ *
+ * Every permutation after the first one is reached with exactly one swap. The recursion depth is k.
+ */
+template<typename RandIter, typename Dist, typename Function>
+constexpr void heapPermutation(const RandIter first, const RandIter last, const Dist k, Function& f)
+		noexcept(noexcept(f(first, last)) && noexcept(constexprStd::iter_swap(first + k, first + k))) {
+	if ( k <= 1 ) {
+		f(first, last);
+		return;
+	} //if ( k <= 1 )
+	
+	for ( Dist i = 0; ; ++i ) {
+		heapPermutation(first, last, k - 1, f);
+		if ( i == k - 1 ) {
+			break;
+		} //if ( i == k - 1 )
+		//For an even k we rotate through all positions, for an odd k we always swap the first element
+		constexprStd::iter_swap(first + (k % 2 == 0 ? i : 0), first + (k - 1));
+	} //for ( Dist i = 0; ; ++i )
+	return;
+}
 } //namespace constexprStd::details
 
 #endif
@@ -24,8 +24,10 @@
 #ifndef CONSTEXPRSTD_DETAILS_ALGORITHM_FORWARD_HPP
 #define CONSTEXPRSTD_DETAILS_ALGORITHM_FORWARD_HPP
 
+#include <iterator>
 #include <type_traits>
 
+#include "functional.hpp"
 #include "iterator_forward.hpp"
 
 namespace constexprStd {
@@ -41,7 +43,10 @@ constexpr ForwardIter1 search(ForwardIter1 first, const ForwardIter1 last,
 		         noexcept(first != last && std::declval<ForwardIter2&>() != s_last &&
 		                  pred(*first, *std::declval<ForwardIter2&>())) &&
 		         noexcept(++first, ++std::declval<ForwardIter2&>()) &&
-		         noexcept(std::declval<ForwardIter2&>() == s_last) && noexcept(first == last));
+		         noexcept(std::declval<ForwardIter2&>() == s_last) && noexcept(first == last) &&
+		         std::disjunction_v<std::negation<details::IsOrderedSearch<ForwardIter1, ForwardIter2, BinaryPredicate>>,
+		                            details::IsNothrowLessComparable<
+		                            	typename std::iterator_traits<ForwardIter1>::value_type>>);
 
 template<typename ForwardIter, typename BinaryPredicate>
 constexpr ForwardIter adjacent_find(ForwardIter first, const ForwardIter last, BinaryPredicate pred)
@@ -53,6 +58,11 @@ constexpr OutputIterator copy(InputIterator sourceFirst, const InputIterator sou
 		noexcept(noexcept(sourceFirst != sourceLast) && noexcept(++sourceFirst) && noexcept(++destination) &&
 		         noexcept(*destination = *sourceFirst));
 
+template<typename InputIterator, typename OutputIterator>
+constexpr OutputIterator move(InputIterator sourceFirst, const InputIterator sourceLast, OutputIterator destination)
+		noexcept(noexcept(sourceFirst != sourceLast) && noexcept(++sourceFirst) && noexcept(++destination) &&
+		         noexcept(*destination = std::move(*sourceFirst)));
+
 template<typename ForwardIter1, typename ForwardIter2>
 constexpr void iter_swap(const ForwardIter1 iter1, const ForwardIter2 iter2)
 		noexcept(std::is_nothrow_swappable_with_v<typename std::iterator_traits<ForwardIter1>::value_type,
@@ -62,6 +72,14 @@ template<typename BidirIter1, typename BidirIter2>
 constexpr BidirIter2 move_backward(const BidirIter1 first, BidirIter1 last, BidirIter2 d_last)
 		noexcept(noexcept(first != last) && noexcept(*--d_last = std::move(*--last)));
 
+template<typename ForwardIter>
+constexpr ForwardIter rotate(ForwardIter first, ForwardIter n_first, const ForwardIter last);
+
+template<typename BidirIter>
+constexpr void reverse(BidirIter first, BidirIter last)
+		noexcept(noexcept(first == last) && noexcept(first != last && first != --last) && noexcept(++first) &&
+		         noexcept(constexprStd::iter_swap(first, last)));
+
 template<typename RandIter, typename Compare = std::less<>,
          typename Dist = typename std::iterator_traits<RandIter>::difference_type>
 constexpr RandIter is_heap_until(const RandIter first, const RandIter last, Compare cmp = {})
@@ -0,0 +1,126 @@
+/**
+ ** This file is part of the constexprStd project.
+ ** Copyright 2017 Björn Schäpers <bjoern@hazardy.de>.
+ **
+ ** This program is free software: you can redistribute it and/or modify
+ ** it under the terms of the GNU Lesser General Public License as
+ ** published by the Free Software Foundation, either version 3 of the
+ ** License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ ** GNU Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public License
+ ** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/**
+ * @file
+ * @brief Contains a temporary buffer for the algorithms, which can make use of extra memory at runtime.
+ */
+
+#ifndef CONSTEXPRSTD_DETAILS_BUFFER_HPP
+#define CONSTEXPRSTD_DETAILS_BUFFER_HPP
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace constexprStd::details {
+/**
+ * @brief A buffer of constructed elements, only usable at runtime.
+ *
+ * The elements are move constructed in a chain from the seed, which gets its value back at the end of the constructor.
+ * So the algorithms can just move assign from and to the buffer. If the allocation fails the buffer is smaller than
+ * requested, or even empty, the algorithms have to cope with that. It is also empty, if T can throw while moving, so no
+ * element can get lost by an exception.
+ */
+template<typename T>
+class TemporaryBuffer {
+	private:
+	T *Data = nullptr;
+	std::ptrdiff_t Size = 0;
+	
+	static constexpr bool OverAligned = alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+	
+	static T* allocate(const std::ptrdiff_t size) noexcept {
+		const auto bytes = static_cast<std::size_t>(size) * sizeof(T);
+		if constexpr ( OverAligned ) {
+			return static_cast<T*>(::operator new(bytes, std::align_val_t{alignof(T)}, std::nothrow));
+		} //if constexpr ( OverAligned )
+		else {
+			return static_cast<T*>(::operator new(bytes, std::nothrow));
+		} //else -> if constexpr ( OverAligned )
+	}
+	
+	public:
+	template<typename Iter>
+	TemporaryBuffer(const Iter seed, std::ptrdiff_t requested) noexcept {
+		if constexpr ( std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T> ) {
+			constexpr auto maxSize = static_cast<std::ptrdiff_t>(std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T));
+			if ( requested > maxSize ) {
+				requested = maxSize;
+			} //if ( requested > maxSize )
+			
+			for ( ; requested > 0; requested /= 2 ) {
+				Data = allocate(requested);
+				if ( Data ) {
+					break;
+				} //if ( Data )
+			} //for ( ; requested > 0; requested /= 2 )
+			
+			if ( !Data ) {
+				return;
+			} //if ( !Data )
+			
+			Size = requested;
+			T *iter = Data;
+			::new (static_cast<void*>(iter)) T(std::move(*seed));
+			for ( T *prev = iter++; iter != Data + Size; prev = iter++ ) {
+				::new (static_cast<void*>(iter)) T(std::move(*prev));
+			} //for ( T *prev = iter++; iter != Data + Size; prev = iter++ )
+			*seed = std::move(*(iter - 1));
+		} //if constexpr ( std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T> )
+		else {
+			static_cast<void>(seed);
+			static_cast<void>(requested);
+		} //else -> if constexpr ( std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T> )
+		return;
+	}
+	
+	TemporaryBuffer(const TemporaryBuffer&) = delete;
+	TemporaryBuffer(TemporaryBuffer&&) = delete;
+	TemporaryBuffer& operator=(const TemporaryBuffer&) = delete;
+	TemporaryBuffer& operator=(TemporaryBuffer&&) = delete;
+	
+	~TemporaryBuffer(void) noexcept {
+		if ( !Data ) {
+			return;
+		} //if ( !Data )
+		
+		std::destroy(Data, Data + Size);
+		if constexpr ( OverAligned ) {
+			::operator delete(Data, std::align_val_t{alignof(T)}, std::nothrow);
+		} //if constexpr ( OverAligned )
+		else {
+			::operator delete(Data, std::nothrow);
+		} //else -> if constexpr ( OverAligned )
+		return;
+	}
+	
+	[[nodiscard]] T* begin(void) noexcept {
+		return Data;
+	}
+	
+	[[nodiscard]] std::ptrdiff_t size(void) const noexcept {
+		return Size;
+	}
+};
+} //namespace constexprStd::details
+
+#endif
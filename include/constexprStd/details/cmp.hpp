@@ -44,6 +44,73 @@ struct Equal {
 		return t1 == t2;
 	}
 };
+
+template<typename Compare>
+struct Flip {
+	Compare& Cmp;
+	
+	template<typename T1, typename T2>
+	constexpr bool operator()(const T1& t1, const T2& t2) const noexcept(noexcept(Cmp(t2, t1))) {
+		return Cmp(t2, t1);
+	}
+};
+
+template<typename Compare>
+Flip(Compare&) -> Flip<Compare>;
+
+template<typename Compare>
+struct NotGreater {
+	Compare& Cmp;
+	
+	template<typename T1, typename T2>
+	constexpr bool operator()(const T1& t1, const T2& t2) const noexcept(noexcept(!Cmp(t2, t1))) {
+		return !Cmp(t2, t1);
+	}
+};
+
+template<typename Compare>
+NotGreater(Compare&) -> NotGreater<Compare>;
+
+template<typename Compare>
+struct Indirect {
+	Compare& Cmp;
+	
+	template<typename Iter1, typename Iter2>
+	constexpr bool operator()(const Iter1& i1, const Iter2& i2) const noexcept(noexcept(Cmp(*i1, *i2))) {
+		return Cmp(*i1, *i2);
+	}
+};
+
+template<typename Compare>
+Indirect(Compare&) -> Indirect<Compare>;
+
+template<typename Compare, typename T>
+struct LessThanValue {
+	Compare& Cmp;
+	const T& Value;
+	
+	template<typename U>
+	constexpr bool operator()(const U& compare) const noexcept(noexcept(Cmp(compare, Value))) {
+		return Cmp(compare, Value);
+	}
+};
+
+template<typename Compare, typename T>
+LessThanValue(Compare&, const T&) -> LessThanValue<Compare, T>;
+
+template<typename Compare, typename T>
+struct NotGreaterThanValue {
+	Compare& Cmp;
+	const T& Value;
+	
+	template<typename U>
+	constexpr bool operator()(const U& compare) const noexcept(noexcept(!Cmp(Value, compare))) {
+		return !Cmp(Value, compare);
+	}
+};
+
+template<typename Compare, typename T>
+NotGreaterThanValue(Compare&, const T&) -> NotGreaterThanValue<Compare, T>;
 } //namespace constexprStd::details::cmp
 
 #endif
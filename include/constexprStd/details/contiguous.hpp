@@ -0,0 +1,545 @@
+/**
+ ** This file is part of the constexprStd project.
+ ** Copyright 2017 Björn Schäpers <bjoern@hazardy.de>.
+ **
+ ** This program is free software: you can redistribute it and/or modify
+ ** it under the terms of the GNU Lesser General Public License as
+ ** published by the Free Software Foundation, either version 3 of the
+ ** License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ ** GNU Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public License
+ ** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/**
+ * @file
+ * @brief Contains the runtime kernels for algorithms on contiguous ranges of trivially comparable elements and the byte
+ *        set of find_first_of.
+ */
+
+#ifndef CONSTEXPRSTD_DETAILS_CONTIGUOUS_HPP
+#define CONSTEXPRSTD_DETAILS_CONTIGUOUS_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "../bitset"
+#include "cmp.hpp"
+#include "functional.hpp"
+#include "helper.hpp"
+
+namespace constexprStd::details {
+template<typename Iter, typename T, typename = void>
+struct IsStringIter : std::false_type { };
+
+template<typename Iter, typename T>
+struct IsStringIter<Iter, T, std::enable_if_t<CountV<T, char, wchar_t, char16_t, char32_t> != 0>>
+	: std::disjunction<std::is_same<Iter, typename std::basic_string<T>::iterator>,
+	                   std::is_same<Iter, typename std::basic_string<T>::const_iterator>,
+	                   std::is_same<Iter, typename std::basic_string_view<T>::const_iterator>> { };
+
+template<typename Iter>
+struct IsNonVolatilePointer : std::conjunction<std::is_pointer<Iter>,
+                                               std::negation<std::is_volatile<std::remove_pointer_t<Iter>>>> { };
+
+template<typename Iter, typename T = std::remove_cv_t<typename std::iterator_traits<Iter>::value_type>,
+         typename = void>
+struct IsContiguousIter : IsNonVolatilePointer<Iter> { };
+
+/**
+ * @brief We can not detect contiguous iterators in general, so for the element types the kernels handle we know the
+ *        ones of the std containers. std::vector<bool> is not contiguous.
+ */
+template<typename Iter, typename T>
+struct IsContiguousIter<Iter, T, std::enable_if_t<std::is_trivially_copyable_v<T> && !std::is_array_v<T> &&
+                                                  !std::is_same_v<T, bool>>>
+	: std::disjunction<IsNonVolatilePointer<Iter>, std::is_same<Iter, typename std::vector<T>::iterator>,
+	                   std::is_same<Iter, typename std::vector<T>::const_iterator>, IsStringIter<Iter, T>> { };
+
+/**
+ * @brief If find_if or count_if with pred can be done by the kernels: pred compares with an integral value and the
+ *        elements are integral and contiguous.
+ */
+template<typename Iter, typename UnaryPredicate>
+struct IsContiguousValueScan : std::false_type { };
+
+template<typename Iter, typename T>
+struct IsContiguousValueScan<Iter, cmp::EqualToValue<T>>
+	: std::conjunction<std::is_integral<std::remove_cv_t<typename std::iterator_traits<Iter>::value_type>>,
+	                   std::is_integral<T>, IsContiguousIter<Iter>> { };
+
+/**
+ * @brief If the contiguous ranges compared with pred can be compared by their bytes: both have the same integral value
+ *        type, which is compared for equality.
+ */
+template<typename Iter1, typename Iter2, typename BinaryPredicate,
+         typename T = std::remove_cv_t<typename std::iterator_traits<Iter1>::value_type>>
+struct IsContiguousEqual : std::conjunction<std::is_integral<T>,
+                                            std::is_same<T, std::remove_cv_t<
+                                                            	typename std::iterator_traits<Iter2>::value_type>>,
+                                            IsEqualTo<BinaryPredicate, T>, IsContiguousIter<Iter1>,
+                                            IsContiguousIter<Iter2>> { };
+
+/**
+ * @brief If the contiguous ranges ordered by cmp can be compared by the kernels: both have the same integral value
+ *        type, which is compared with <.
+ */
+template<typename Iter1, typename Iter2, typename Compare,
+         typename T = std::remove_cv_t<typename std::iterator_traits<Iter1>::value_type>>
+struct IsContiguousLess : std::conjunction<IsContiguousEqual<Iter1, Iter2, std::equal_to<>>,
+                                           std::disjunction<std::is_same<Compare, std::less<>>,
+                                                            std::is_same<Compare, std::less<T>>>> { };
+
+/**
+ * @brief If the contiguous range at InIter can be copied or moved to the one at OutIter with memmove: both have the
+ *        same trivially copyable value type, whose assignments are trivial.
+ */
+template<typename InIter, typename OutIter,
+         typename T = std::remove_cv_t<typename std::iterator_traits<InIter>::value_type>,
+         typename OutT = std::remove_cv_t<typename std::iterator_traits<OutIter>::value_type>>
+struct IsContiguousTrivialCopy : std::conjunction<std::is_trivially_copyable<T>, std::is_trivially_copy_assignable<T>,
+                                                  std::is_trivially_move_assignable<T>, std::is_same<T, OutT>,
+                                                  IsContiguousIter<InIter>, IsContiguousIter<OutIter>> { };
+
+/**
+ * @brief If the contiguous range at Iter can be filled with copies of its first element, after assigning value to it:
+ *        the value type is trivially copyable and the assignment of value is built in or trivial.
+ */
+template<typename Iter, typename T,
+         typename ValueType = std::remove_cv_t<typename std::iterator_traits<Iter>::value_type>>
+struct IsContiguousFill : std::conjunction<std::is_trivially_copyable<ValueType>,
+                                           std::is_trivially_copy_assignable<ValueType>,
+                                           std::disjunction<std::is_same<ValueType, std::remove_cv_t<T>>,
+                                                            std::conjunction<std::is_scalar<ValueType>,
+                                                                             std::is_scalar<T>>>,
+                                           IsContiguousIter<Iter>> { };
+
+/**
+ * @brief If find_first_of with pred can look the elements up in a set of the 256 byte values: both ranges have the same
+ *        byte sized value type, which is compared for equality.
+ */
+template<typename InputIter, typename ForwardIter, typename BinaryPredicate,
+         typename T = std::remove_cv_t<typename std::iterator_traits<InputIter>::value_type>>
+struct IsByteSetSearch : std::conjunction<IsByteLike<T>,
+                                          std::is_same<T, std::remove_cv_t<
+                                                          	typename std::iterator_traits<ForwardIter>::value_type>>,
+                                          IsEqualTo<BinaryPredicate, T>> { };
+
+using ByteSet = bitset<256>;
+
+template<typename T>
+constexpr std::size_t toByteIndex(const T byte) noexcept {
+	return static_cast<std::size_t>(static_cast<unsigned char>(byte));
+}
+
+template<typename ForwardIter>
+constexpr ByteSet makeByteSet(ForwardIter first, const ForwardIter last)
+		noexcept(noexcept(first != last) && noexcept(++first) && noexcept(*first)) {
+	ByteSet ret;
+	for ( ; first != last; ++first ) {
+		ret[toByteIndex(*first)] = true;
+	} //for ( ; first != last; ++first )
+	return ret;
+}
+
+/**
+ * @brief The find_first_of for IsByteSetSearch, one lookup per element instead of comparing it with every needle.
+ */
+template<typename InputIter>
+constexpr InputIter findFirstOfByteSet(InputIter first, const InputIter last, const ByteSet& set)
+		noexcept(noexcept(first != last) && noexcept(++first) && noexcept(*first)) {
+	for ( ; first != last && !set[toByteIndex(*first)]; ++first ) {
+		
+	} //for ( ; first != last && !set[toByteIndex(*first)]; ++first )
+	return first;
+}
+
+template<typename ContiguousIter>
+auto toPointer(const ContiguousIter iter) noexcept {
+	if constexpr ( std::is_pointer_v<ContiguousIter> ) {
+		return iter;
+	} //if constexpr ( std::is_pointer_v<ContiguousIter> )
+	else {
+		return std::addressof(*iter);
+	} //else -> if constexpr ( std::is_pointer_v<ContiguousIter> )
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Compares a vector register full of elements at once, until a match is found.
+ * @return The match or the position from which less than a register full of elements are left.
+ */
+template<typename T>
+const T* findVectorized(const T *first, const T *const last, const T value) noexcept {
+	static_assert(sizeof(T) == 2 || sizeof(T) == 4);
+#if defined(__AVX2__)
+	using Vector = __m256i;
+	const Vector needle = sizeof(T) == 2 ? _mm256_set1_epi16(static_cast<short>(value)) :
+	                                       _mm256_set1_epi32(static_cast<int>(value));
+	auto matches = [&needle](const T *const pos) noexcept {
+		const Vector block = _mm256_loadu_si256(reinterpret_cast<const Vector*>(pos));
+		return static_cast<unsigned int>(_mm256_movemask_epi8(sizeof(T) == 2 ? _mm256_cmpeq_epi16(block, needle) :
+		                                                                       _mm256_cmpeq_epi32(block, needle)));
+	};
+#else
+	using Vector = __m128i;
+	const Vector needle = sizeof(T) == 2 ? _mm_set1_epi16(static_cast<short>(value)) :
+	                                       _mm_set1_epi32(static_cast<int>(value));
+	auto matches = [&needle](const T *const pos) noexcept {
+		const Vector block = _mm_loadu_si128(reinterpret_cast<const Vector*>(pos));
+		return static_cast<unsigned int>(_mm_movemask_epi8(sizeof(T) == 2 ? _mm_cmpeq_epi16(block, needle) :
+		                                                                    _mm_cmpeq_epi32(block, needle)));
+	};
+#endif
+	
+	constexpr auto perVector = static_cast<std::ptrdiff_t>(sizeof(Vector) / sizeof(T));
+	for ( ; last - first >= perVector; first += perVector ) {
+		if ( const auto mask = matches(first); mask != 0 ) {
+			//The mask has a bit per byte
+			return first + static_cast<std::size_t>(__builtin_ctz(mask)) / sizeof(T);
+		} //if ( const auto mask = matches(first); mask != 0 )
+	} //for ( ; last - first >= perVector; first += perVector )
+	return first;
+}
+#endif
+
+#if defined(__SSSE3__)
+/**
+ * @brief Looks up a vector register full of bytes at once in the set of the needles, until one is found.
+ *
+ * The set is stored as two tables indexed by the low nibble, each byte of them has a bit for eight of the high nibbles.
+ * pshufb looks up all bytes of the register in the tables and in the bits of the high nibbles.
+ * @return The first match or last.
+ */
+inline const unsigned char* findFirstOfVectorized(const unsigned char *first, const unsigned char *const last,
+                                                  const unsigned char *s_first,
+                                                  const unsigned char *const s_last) noexcept {
+	alignas(16) unsigned char lowerHighNibbles[16] = {};
+	alignas(16) unsigned char upperHighNibbles[16] = {};
+	for ( ; s_first != s_last; ++s_first ) {
+		unsigned char *const table = *s_first < 0x80 ? lowerHighNibbles : upperHighNibbles;
+		table[*s_first & 0x0F] = static_cast<unsigned char>(table[*s_first & 0x0F] | 1 << (*s_first >> 4 & 0x07));
+	} //for ( ; s_first != s_last; ++s_first )
+	
+#if defined(__AVX2__)
+	using Vector = __m256i;
+	const Vector lowerTable = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(
+	                                                                     	lowerHighNibbles)));
+	const Vector upperTable = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(
+	                                                                     	upperHighNibbles)));
+	const Vector bitTable   = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+	                                           1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+	const Vector nibbleMask = _mm256_set1_epi8(0x0F);
+	const Vector seven      = _mm256_set1_epi8(7);
+	auto matches = [&](const unsigned char *const pos) noexcept {
+		const Vector block = _mm256_loadu_si256(reinterpret_cast<const Vector*>(pos));
+		const Vector low   = _mm256_and_si256(block, nibbleMask);
+		const Vector high  = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibbleMask);
+		const Vector upper = _mm256_cmpgt_epi8(high, seven);
+		const Vector row   = _mm256_or_si256(_mm256_andnot_si256(upper, _mm256_shuffle_epi8(lowerTable, low)),
+		                                     _mm256_and_si256(upper, _mm256_shuffle_epi8(upperTable, low)));
+		const Vector hits  = _mm256_and_si256(row, _mm256_shuffle_epi8(bitTable, high));
+		return ~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hits, _mm256_setzero_si256())));
+	};
+#else
+	using Vector = __m128i;
+	const Vector lowerTable = _mm_load_si128(reinterpret_cast<const Vector*>(lowerHighNibbles));
+	const Vector upperTable = _mm_load_si128(reinterpret_cast<const Vector*>(upperHighNibbles));
+	const Vector bitTable   = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+	const Vector nibbleMask = _mm_set1_epi8(0x0F);
+	const Vector seven      = _mm_set1_epi8(7);
+	auto matches = [&](const unsigned char *const pos) noexcept {
+		const Vector block = _mm_loadu_si128(reinterpret_cast<const Vector*>(pos));
+		const Vector low   = _mm_and_si128(block, nibbleMask);
+		const Vector high  = _mm_and_si128(_mm_srli_epi16(block, 4), nibbleMask);
+		const Vector upper = _mm_cmpgt_epi8(high, seven);
+		const Vector row   = _mm_or_si128(_mm_andnot_si128(upper, _mm_shuffle_epi8(lowerTable, low)),
+		                                  _mm_and_si128(upper, _mm_shuffle_epi8(upperTable, low)));
+		const Vector hits  = _mm_and_si128(row, _mm_shuffle_epi8(bitTable, high));
+		return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(hits, _mm_setzero_si128()))) ^ 0xFFFFu;
+	};
+#endif
+	
+	constexpr auto perVector = static_cast<std::ptrdiff_t>(sizeof(Vector));
+	for ( ; last - first >= perVector; first += perVector ) {
+		if ( const auto mask = matches(first); mask != 0 ) {
+			return first + __builtin_ctz(mask);
+		} //if ( const auto mask = matches(first); mask != 0 )
+	} //for ( ; last - first >= perVector; first += perVector )
+	
+	for ( ; first != last; ++first ) {
+		const unsigned char *const table = *first < 0x80 ? lowerHighNibbles : upperHighNibbles;
+		if ( table[*first & 0x0F] >> (*first >> 4 & 0x07) & 1 ) {
+			return first;
+		} //if ( table[*first & 0x0F] >> (*first >> 4 & 0x07) & 1 )
+	} //for ( ; first != last; ++first )
+	return last;
+}
+#endif
+
+template<typename T>
+const T* findValue(const T *first, const T *const last, const T value) noexcept {
+	if constexpr ( sizeof(T) == 1 ) {
+		const void *const match = std::memchr(first, static_cast<unsigned char>(value),
+		                                      static_cast<std::size_t>(last - first));
+		return match ? static_cast<const T*>(match) : last;
+	} //if constexpr ( sizeof(T) == 1 )
+	else {
+#if defined(__SSE2__)
+		if constexpr ( sizeof(T) == 2 || sizeof(T) == 4 ) {
+			first = findVectorized(first, last, value);
+		} //if constexpr ( sizeof(T) == 2 || sizeof(T) == 4 )
+#endif
+		
+		//Unrolled, so we check the end only every fourth element
+		for ( ; last - first >= 4; first += 4 ) {
+			if ( first[0] == value ) {
+				return first;
+			} //if ( first[0] == value )
+			if ( first[1] == value ) {
+				return first + 1;
+			} //if ( first[1] == value )
+			if ( first[2] == value ) {
+				return first + 2;
+			} //if ( first[2] == value )
+			if ( first[3] == value ) {
+				return first + 3;
+			} //if ( first[3] == value )
+		} //for ( ; last - first >= 4; first += 4 )
+		
+		for ( ; first != last && !(*first == value); ++first ) {
+			
+		} //for ( ; first != last && !(*first == value); ++first )
+		return first;
+	} //else -> if constexpr ( sizeof(T) == 1 )
+}
+
+template<typename T>
+std::ptrdiff_t countValue(const T *first, const T *const last, const T value) noexcept {
+	std::ptrdiff_t ret = 0;
+	for ( ; first != last; ++first ) {
+		ret += *first == value;
+	} //for ( ; first != last; ++first )
+	return ret;
+}
+
+/**
+ * @brief Returns the first element of [first1, last1) which differs from its counterpart in the range at first2.
+ *
+ * Equal blocks are skipped with memcmp, only the first unequal one is compared element by element.
+ */
+template<typename T>
+const T* mismatchValue(const T *first1, const T *const last1, const T *first2) noexcept {
+	constexpr auto blockSize  = static_cast<std::ptrdiff_t>(256 / sizeof(T));
+	constexpr auto blockBytes = static_cast<std::size_t>(blockSize) * sizeof(T);
+	for ( ; last1 - first1 >= blockSize && std::memcmp(first1, first2, blockBytes) == 0;
+	      first1 += blockSize, first2 += blockSize ) {
+		
+	} //for ( ; last1 - first1 >= blockSize && std::memcmp(first1, first2, blockBytes) == 0; ... )
+	
+	for ( ; first1 != last1 && *first1 == *first2; ++first1, ++first2 ) {
+		
+	} //for ( ; first1 != last1 && *first1 == *first2; ++first1, ++first2 )
+	return first1;
+}
+
+/**
+ * @brief The runtime equal for IsContiguousEqual, the range starting at first2 has at least as many elements.
+ */
+template<typename ContiguousIter1, typename ContiguousIter2>
+bool equalContiguous(const ContiguousIter1 first1, const ContiguousIter1 last1, const ContiguousIter2 first2) noexcept {
+	using ValueType = std::remove_cv_t<typename std::iterator_traits<ContiguousIter1>::value_type>;
+	if ( first1 == last1 ) {
+		return true;
+	} //if ( first1 == last1 )
+	
+	const auto size = static_cast<std::size_t>(last1 - first1);
+	return std::memcmp(toPointer(first1), toPointer(first2), size * sizeof(ValueType)) == 0;
+}
+
+/**
+ * @brief The runtime mismatch for IsContiguousEqual, only the first size elements of both ranges are compared.
+ */
+template<typename ContiguousIter1, typename ContiguousIter2>
+std::pair<ContiguousIter1, ContiguousIter2> mismatchContiguous(const ContiguousIter1 first1,
+                                                               const ContiguousIter2 first2,
+                                                               const std::ptrdiff_t size) noexcept {
+	if ( size == 0 ) {
+		return {first1, first2};
+	} //if ( size == 0 )
+	
+	const auto *const begin1 = toPointer(first1);
+	const auto offset = mismatchValue(begin1, begin1 + size, toPointer(first2)) - begin1;
+	return {first1 + offset, first2 + offset};
+}
+
+/**
+ * @brief The runtime lexicographical_compare for IsContiguousLess.
+ */
+template<typename ContiguousIter1, typename ContiguousIter2>
+bool lexicographicalCompareContiguous(const ContiguousIter1 first1, const ContiguousIter1 last1,
+                                      const ContiguousIter2 first2, const ContiguousIter2 last2) noexcept {
+	using ValueType = std::remove_cv_t<typename std::iterator_traits<ContiguousIter1>::value_type>;
+	const auto size1 = static_cast<std::ptrdiff_t>(last1 - first1);
+	const auto size2 = static_cast<std::ptrdiff_t>(last2 - first2);
+	const auto size  = size1 < size2 ? size1 : size2;
+	
+	if ( size != 0 ) {
+		const ValueType *const begin1 = toPointer(first1);
+		const ValueType *const begin2 = toPointer(first2);
+		if constexpr ( sizeof(ValueType) == 1 && std::is_unsigned_v<ValueType> ) {
+			//memcmp compares unsigned chars, which then is the order of the elements
+			if ( const int result = std::memcmp(begin1, begin2, static_cast<std::size_t>(size)); result != 0 ) {
+				return result < 0;
+			} //if ( const int result = std::memcmp(begin1, begin2, static_cast<std::size_t>(size)); result != 0 )
+		} //if constexpr ( sizeof(ValueType) == 1 && std::is_unsigned_v<ValueType> )
+		else {
+			const ValueType *const mismatch = mismatchValue(begin1, begin1 + size, begin2);
+			if ( mismatch != begin1 + size ) {
+				return *mismatch < begin2[mismatch - begin1];
+			} //if ( mismatch != begin1 + size )
+		} //else -> if constexpr ( sizeof(ValueType) == 1 && std::is_unsigned_v<ValueType> )
+	} //if ( size != 0 )
+	return size1 < size2;
+}
+
+/**
+ * @brief The runtime find_if for IsContiguousValueScan.
+ */
+template<typename ContiguousIter, typename T>
+ContiguousIter findContiguous(const ContiguousIter first, const ContiguousIter last, const cmp::EqualToValue<T> pred)
+		noexcept {
+	using ValueType = std::remove_cv_t<typename std::iterator_traits<ContiguousIter>::value_type>;
+	const auto value = static_cast<ValueType>(pred.Object);
+	//If the value is not representable by the elements, none of them can compare equal
+	if ( first == last || !pred(value) ) {
+		return last;
+	} //if ( first == last || !pred(value) )
+	
+	const ValueType *const begin = toPointer(first);
+	return first + (findValue(begin, begin + (last - first), value) - begin);
+}
+
+/**
+ * @brief The runtime find_first_of for IsByteSetSearch, on contiguous ranges.
+ */
+template<typename ContiguousIter1, typename ContiguousIter2>
+ContiguousIter1 findFirstOfContiguous(const ContiguousIter1 first, const ContiguousIter1 last,
+                                      const ContiguousIter2 s_first, const ContiguousIter2 s_last) noexcept {
+	if ( first == last || s_first == s_last ) {
+		return last;
+	} //if ( first == last || s_first == s_last )
+	
+	//The character types may alias with unsigned char
+	const auto begin = reinterpret_cast<const unsigned char*>(toPointer(first));
+	const auto end   = begin + (last - first);
+#if defined(__SSSE3__)
+	const auto needles = reinterpret_cast<const unsigned char*>(toPointer(s_first));
+	return first + (findFirstOfVectorized(begin, end, needles, needles + (s_last - s_first)) - begin);
+#else
+	return first + (findFirstOfByteSet(begin, end, makeByteSet(s_first, s_last)) - begin);
+#endif
+}
+
+/**
+ * @brief The runtime count_if for IsContiguousValueScan.
+ */
+template<typename ContiguousIter, typename T>
+auto countContiguous(const ContiguousIter first, const ContiguousIter last, const cmp::EqualToValue<T> pred)
+		noexcept {
+	using ValueType = std::remove_cv_t<typename std::iterator_traits<ContiguousIter>::value_type>;
+	using Dist      = typename std::iterator_traits<ContiguousIter>::difference_type;
+	const auto value = static_cast<ValueType>(pred.Object);
+	if ( first == last || !pred(value) ) {
+		return Dist{0};
+	} //if ( first == last || !pred(value) )
+	
+	const ValueType *const begin = toPointer(first);
+	return static_cast<Dist>(countValue(begin, begin + (last - first), value));
+}
+
+/**
+ * @brief The runtime copy and move for IsContiguousTrivialCopy.
+ */
+template<typename ContiguousIter1, typename ContiguousIter2>
+ContiguousIter2 copyContiguous(const ContiguousIter1 first, const std::ptrdiff_t size,
+                               const ContiguousIter2 destination) noexcept {
+	using ValueType = std::remove_cv_t<typename std::iterator_traits<ContiguousIter1>::value_type>;
+	if ( size <= 0 ) {
+		return destination;
+	} //if ( size <= 0 )
+	
+	std::memmove(toPointer(destination), toPointer(first), static_cast<std::size_t>(size) * sizeof(ValueType));
+	return destination + size;
+}
+
+/**
+ * @brief The runtime copy_backward and move_backward for IsContiguousTrivialCopy.
+ */
+template<typename ContiguousIter1, typename ContiguousIter2>
+ContiguousIter2 copyBackwardContiguous(const ContiguousIter1 first, const std::ptrdiff_t size,
+                                       const ContiguousIter2 d_last) noexcept {
+	if ( size <= 0 ) {
+		return d_last;
+	} //if ( size <= 0 )
+	return copyContiguous(first, size, d_last - size) - size;
+}
+
+/**
+ * @brief The runtime fill for IsContiguousFill.
+ *
+ * Bytes are set with memset, for larger elements the filled part is doubled with memcpy, which uses the widest stores.
+ * The copied chunks are limited, so the source stays in the cache.
+ */
+template<typename ContiguousIter, typename T>
+void fillContiguous(const ContiguousIter first, const std::ptrdiff_t size, const T& value) noexcept {
+	using ValueType = std::remove_cv_t<typename std::iterator_traits<ContiguousIter>::value_type>;
+	if ( size <= 0 ) {
+		return;
+	} //if ( size <= 0 )
+	
+	ValueType *const begin = toPointer(first);
+	*begin = value;
+	if constexpr ( sizeof(ValueType) == 1 ) {
+		unsigned char byte = 0;
+		std::memcpy(&byte, begin, 1);
+		std::memset(begin + 1, byte, static_cast<std::size_t>(size - 1));
+	} //if constexpr ( sizeof(ValueType) == 1 )
+	else {
+		constexpr std::size_t maxChunkBytes = 16384;
+		constexpr auto maxChunk = static_cast<std::ptrdiff_t>(sizeof(ValueType) < maxChunkBytes ?
+		                                                      maxChunkBytes / sizeof(ValueType) : 1);
+		for ( std::ptrdiff_t filled = 1; filled < size; ) {
+			auto chunk = filled < size - filled ? filled : size - filled;
+			if ( chunk > maxChunk ) {
+				chunk = maxChunk;
+			} //if ( chunk > maxChunk )
+			std::memcpy(begin + filled, begin, static_cast<std::size_t>(chunk) * sizeof(ValueType));
+			filled += chunk;
+		} //for ( std::ptrdiff_t filled = 1; filled < size; )
+	} //else -> if constexpr ( sizeof(ValueType) == 1 )
+	return;
+}
+} //namespace constexprStd::details
+
+#endif
@@ -26,11 +26,19 @@
 
 #include "../functional"
 #include "cmp.hpp"
+#include "contiguous.hpp"
 
 namespace constexprStd {
 template<typename InputIter, typename UnaryPredicate>
 constexpr InputIter find_if(InputIter first, const InputIter last, const UnaryPredicate pred)
 		noexcept(noexcept(first != last && !pred(*first)) && noexcept(++first)) {
+	if constexpr ( details::IsContiguousValueScan<InputIter, UnaryPredicate>::value ) {
+		//At runtime use memchr or compare blocks of elements, which can be vectorized
+		if ( !details::isConstantEvaluated() ) {
+			return details::findContiguous(first, last, pred);
+		} //if ( !details::isConstantEvaluated() )
+	} //if constexpr ( details::IsContiguousValueScan<InputIter, UnaryPredicate>::value )
+	
 	for ( ; first != last && !pred(*first); ++first ) {
 		
 	} //for ( ; first != last && !pred(*first); ++first )
@@ -24,9 +24,18 @@
 #ifndef CONSTEXPRSTD_DETAILS_FUNCTIONAL_HPP
 #define CONSTEXPRSTD_DETAILS_FUNCTIONAL_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 
+#include "cmp.hpp"
+#include "helper.hpp"
+
 namespace constexprStd {
 template<typename F, typename... Args>
 constexpr decltype(auto) invoke(F&& f, Args&&... args) noexcept(std::is_nothrow_invocable_v<F, Args...>);
@@ -77,6 +86,553 @@ constexpr decltype(auto) invokeImpl(Function&& func, Args&&... args)
 		noexcept(std::is_nothrow_invocable_v<Function, Args...>) {
 	return std::forward<Function>(func)(std::forward<Args>(args)...);
 }
+
+template<typename T>
+struct IsByteLike : std::bool_constant<(std::is_integral_v<T> && sizeof(T) == 1 && !std::is_same_v<T, bool>) ||
+                                       std::is_same_v<T, std::byte>> { };
+
+/**
+ * @brief The bad character table for byte sized elements, a flat array indexed by the byte value.
+ */
+template<typename RandIter>
+class HorspoolByteTable {
+	private:
+	using DistType = typename std::iterator_traits<RandIter>::difference_type;
+	
+	DistType Skip[256] = {};
+	
+	public:
+	constexpr HorspoolByteTable(const RandIter patFirst, const DistType length) noexcept {
+		for ( auto& skip : Skip ) {
+			skip = length;
+		} //for ( auto& skip : Skip )
+		
+		for ( DistType i = 0; i < length - 1; ++i ) {
+			Skip[static_cast<unsigned char>(patFirst[i])] = length - 1 - i;
+		} //for ( DistType i = 0; i < length - 1; ++i )
+		return;
+	}
+	
+	template<typename T>
+	[[nodiscard]] constexpr DistType operator()(const RandIter, const T& value) const noexcept {
+		return Skip[static_cast<unsigned char>(value)];
+	}
+};
+
+/**
+ * @brief The bad character table for all other elements, a small table of pattern positions sorted by their values.
+ *
+ * Only the last Capacity positions before the end of the pattern are recorded. Every element not found in the table
+ * occurs at the earliest before that window, so we can still skip the window size plus one.
+ */
+template<typename RandIter>
+class HorspoolSortedTable {
+	private:
+	using DistType = typename std::iterator_traits<RandIter>::difference_type;
+	
+	static constexpr DistType Capacity = 64;
+	
+	struct Entry {
+		DistType Index;
+		DistType Skip;
+	};
+	
+	Entry Entries[Capacity] = {};
+	DistType Count          = 0;
+	DistType DefaultSkip;
+	
+	template<typename T>
+	[[nodiscard]] constexpr DistType lowerBound(const RandIter patFirst, const T& value) const
+			noexcept(noexcept(patFirst[0] < value)) {
+		DistType first = 0, length = Count;
+		while ( length > 0 ) {
+			const DistType half = length / 2;
+			if ( patFirst[Entries[first + half].Index] < value ) {
+				first  += half + 1;
+				length -= half + 1;
+			} //if ( patFirst[Entries[first + half].Index] < value )
+			else {
+				length = half;
+			} //else -> if ( patFirst[Entries[first + half].Index] < value )
+		} //while ( length > 0 )
+		return first;
+	}
+	
+	public:
+	constexpr HorspoolSortedTable(const RandIter patFirst, const DistType length)
+			noexcept(noexcept(patFirst[0] < patFirst[0])) :
+			DefaultSkip((length - 1 < Capacity ? length - 1 : Capacity) + 1) {
+		const DistType window = DefaultSkip - 1;
+		for ( DistType i = length - 1 - window; i < length - 1; ++i ) {
+			const DistType pos = lowerBound(patFirst, patFirst[i]);
+			if ( pos == Count || patFirst[i] < patFirst[Entries[pos].Index] ) {
+				for ( DistType move = Count; move > pos; --move ) {
+					Entries[move] = Entries[move - 1];
+				} //for ( DistType move = Count; move > pos; --move )
+				++Count;
+			} //if ( pos == Count || patFirst[i] < patFirst[Entries[pos].Index] )
+			Entries[pos] = {i, length - 1 - i};
+		} //for ( DistType i = length - 1 - window; i < length - 1; ++i )
+		return;
+	}
+	
+	template<typename T>
+	[[nodiscard]] constexpr DistType operator()(const RandIter patFirst, const T& value) const
+			noexcept(noexcept(patFirst[0] < value) && noexcept(value < patFirst[0])) {
+		const DistType pos = lowerBound(patFirst, value);
+		if ( pos == Count || value < patFirst[Entries[pos].Index] ) {
+			return DefaultSkip;
+		} //if ( pos == Count || value < patFirst[Entries[pos].Index] )
+		return Entries[pos].Skip;
+	}
+};
+
+/**
+ * @brief The bad character "table" for elements which can not be grouped by their value, every shift is 1.
+ */
+template<typename RandIter>
+class HorspoolUnitTable {
+	private:
+	using DistType = typename std::iterator_traits<RandIter>::difference_type;
+	
+	public:
+	constexpr HorspoolUnitTable(const RandIter, const DistType) noexcept {
+		return;
+	}
+	
+	template<typename T>
+	[[nodiscard]] constexpr DistType operator()(const RandIter, const T&) const noexcept {
+		return 1;
+	}
+};
+
+/**
+ * @brief The bad character table for elements whose < equivalence is the equality.
+ */
+template<typename RandIter>
+using HorspoolTable = std::conditional_t<IsByteLike<typename std::iterator_traits<RandIter>::value_type>::value,
+                                         HorspoolByteTable<RandIter>, HorspoolSortedTable<RandIter>>;
+
+/**
+ * @brief The Boyer-Moore-Horspool search of the non empty pattern [patFirst, patFirst + length) with its table.
+ * @return The start of the first occurrence, or last.
+ */
+template<typename RandIter1, typename RandIter2, typename DistType, typename Table, typename BinaryPredicate>
+constexpr RandIter2 horspoolSearch(RandIter2 first, const RandIter2 last, const RandIter1 patFirst,
+                                   const DistType length, const Table& table, BinaryPredicate& pred)
+		noexcept(noexcept(pred(first[0], patFirst[0])) && noexcept(table(patFirst, first[0])) &&
+		         noexcept(last - first) && noexcept(first += length)) {
+	const DistType lastIndex = length - 1;
+	for ( ; last - first >= length; first += table(patFirst, first[lastIndex]) ) {
+		//Compare from the back, the last element is the one most likely to differ
+		for ( DistType k = lastIndex; pred(first[k], patFirst[k]); --k ) {
+			if ( k == 0 ) {
+				return first;
+			} //if ( k == 0 )
+		} //for ( DistType k = lastIndex; pred(first[k], patFirst[k]); --k )
+	} //for ( ; last - first >= length; first += table(patFirst, first[lastIndex]) )
+	return last;
+}
+
+/**
+ * @brief The (strong) good suffix table of the Boyer-Moore algorithm.
+ *
+ * It is computed for the last Capacity elements of the pattern, positions before that window are treated as if they
+ * were before the pattern, i.e. they match everything. That can only make the shifts smaller, so they stay correct.
+ * A mismatch before the window uses the shift for a complete match of the window.
+ */
+template<typename RandIter>
+class GoodSuffixTable {
+	private:
+	using DistType = typename std::iterator_traits<RandIter>::difference_type;
+	
+	static constexpr DistType Capacity = 256;
+	
+	DistType Shift[Capacity] = {};
+	DistType Offset;
+	
+	public:
+	template<typename BinaryPredicate>
+	constexpr GoodSuffixTable(const RandIter patFirst, const DistType length, BinaryPredicate& pred)
+			noexcept(noexcept(pred(patFirst[0], patFirst[0]))) : Offset(length < Capacity ? 0 : length - Capacity) {
+		const RandIter window = patFirst + Offset;
+		const DistType m      = length - Offset;
+		if ( m == 0 ) {
+			return;
+		} //if ( m == 0 )
+		
+		//suffix[i] is the length of the longest common suffix of window[0, i] and the window
+		DistType suffix[Capacity] = {};
+		suffix[m - 1] = m;
+		for ( DistType i = m - 2, f = m - 1, g = m - 1; i >= 0; --i ) {
+			if ( i > g && suffix[i + m - 1 - f] < i - g ) {
+				suffix[i] = suffix[i + m - 1 - f];
+			} //if ( i > g && suffix[i + m - 1 - f] < i - g )
+			else {
+				if ( i < g ) {
+					g = i;
+				} //if ( i < g )
+				f = i;
+				while ( g >= 0 && pred(window[g], window[g + m - 1 - f]) ) {
+					--g;
+				} //while ( g >= 0 && pred(window[g], window[g + m - 1 - f]) )
+				suffix[i] = f - g;
+			} //else -> if ( i > g && suffix[i + m - 1 - f] < i - g )
+		} //for ( DistType i = m - 2, f = m - 1, g = m - 1; i >= 0; --i )
+		
+		//Case 1: only a prefix of the window matches a part of the good suffix
+		for ( DistType i = 0; i < m; ++i ) {
+			Shift[i] = m;
+		} //for ( DistType i = 0; i < m; ++i )
+		for ( DistType i = m - 1, j = 0; i >= 0; --i ) {
+			if ( suffix[i] == i + 1 ) {
+				for ( ; j < m - 1 - i; ++j ) {
+					if ( Shift[j] == m ) {
+						Shift[j] = m - 1 - i;
+					} //if ( Shift[j] == m )
+				} //for ( ; j < m - 1 - i; ++j )
+			} //if ( suffix[i] == i + 1 )
+		} //for ( DistType i = m - 1, j = 0; i >= 0; --i )
+		
+		//Case 2: the good suffix occurs again, preceded by a different element
+		for ( DistType i = 0; i < m - 1; ++i ) {
+			Shift[m - 1 - suffix[i]] = m - 1 - i;
+		} //for ( DistType i = 0; i < m - 1; ++i )
+		return;
+	}
+	
+	/**
+	 * @brief Returns the shift for a mismatch at the given position of the pattern.
+	 */
+	[[nodiscard]] constexpr DistType operator()(const DistType mismatch) const noexcept {
+		return mismatch < Offset ? Shift[0] : Shift[mismatch - Offset];
+	}
+};
+
+/**
+ * @brief The critical factorization of a pattern for the Two-Way algorithm.
+ */
+template<typename DistType>
+struct TwoWayFactorization {
+	//The last index of the left part
+	DistType Split  = -1;
+	DistType Period = 1;
+	bool Periodic   = false;
+};
+
+/**
+ * @brief Computes the maximal suffix of [x, x + m) according to cmp and its period.
+ */
+template<typename RandIter, typename DistType, typename Compare>
+constexpr TwoWayFactorization<DistType> maximalSuffix(const RandIter x, const DistType m, Compare cmp)
+		noexcept(noexcept(cmp(x[0], x[0]))) {
+	DistType suffix = -1, j = 0, k = 1, period = 1;
+	while ( j + k < m ) {
+		if ( cmp(x[j + k], x[suffix + k]) ) {
+			j     += k;
+			k      = 1;
+			period = j - suffix;
+		} //if ( cmp(x[j + k], x[suffix + k]) )
+		else if ( cmp(x[suffix + k], x[j + k]) ) {
+			suffix = j;
+			j      = suffix + 1;
+			k      = 1;
+			period = 1;
+		} //else if ( cmp(x[suffix + k], x[j + k]) )
+		else if ( k != period ) {
+			++k;
+		} //else if ( k != period )
+		else {
+			j += period;
+			k  = 1;
+		} //else
+	} //while ( j + k < m )
+	return {suffix, period, false};
+}
+
+/**
+ * @brief Computes the critical factorization of the non empty pattern [x, x + m).
+ *
+ * It is the later of the maximal suffixes for cmp and the reversed order. If the left part does not occur again one
+ * period later, the pattern is not periodic and we can shift further.
+ */
+template<typename RandIter, typename DistType, typename BinaryPredicate, typename Compare>
+constexpr TwoWayFactorization<DistType> twoWayFactorize(const RandIter x, const DistType m, BinaryPredicate& pred,
+                                                        Compare& cmp)
+		noexcept(noexcept(cmp(x[0], x[0])) && noexcept(pred(x[0], x[0]))) {
+	const auto forward  = maximalSuffix(x, m, cmp);
+	const auto backward = maximalSuffix(x, m, cmp::Flip{cmp});
+	auto ret            = forward.Split > backward.Split ? forward : backward;
+	
+	ret.Periodic = true;
+	for ( DistType i = 0; i <= ret.Split; ++i ) {
+		if ( !pred(x[i], x[i + ret.Period]) ) {
+			ret.Periodic = false;
+			break;
+		} //if ( !pred(x[i], x[i + ret.Period]) )
+	} //for ( DistType i = 0; i <= ret.Split; ++i )
+	
+	if ( !ret.Periodic ) {
+		const DistType right = m - ret.Split - 1;
+		ret.Period           = (ret.Split + 1 > right ? ret.Split + 1 : right) + 1;
+	} //if ( !ret.Periodic )
+	return ret;
+}
+
+/**
+ * @brief The Two-Way search of Crochemore and Perrin, in O(n + m) time with constant extra space.
+ *
+ * The right part of the pattern is compared left to right, then the left part right to left. For a periodic pattern
+ * we remember how much of the left part is already known to match after a shift by the period.
+ *
+ * @return The start of the first occurrence of the non empty pattern [x, x + m), or last.
+ */
+template<typename RandIter1, typename RandIter2, typename DistType, typename BinaryPredicate>
+constexpr RandIter2 twoWaySearch(const RandIter2 first, const RandIter2 last, const RandIter1 x, const DistType m,
+                                 const TwoWayFactorization<DistType>& factorization, BinaryPredicate& pred)
+		noexcept(noexcept(pred(*first, *x))) {
+	const DistType n = static_cast<DistType>(last - first);
+	DistType memory  = -1;
+	
+	for ( DistType j = 0; j <= n - m; ) {
+		const RandIter2 y = first + j;
+		DistType i        = (memory > factorization.Split ? memory : factorization.Split) + 1;
+		while ( i < m && pred(y[i], x[i]) ) {
+			++i;
+		} //while ( i < m && pred(y[i], x[i]) )
+		
+		if ( i < m ) {
+			j      += i - factorization.Split;
+			memory  = -1;
+			continue;
+		} //if ( i < m )
+		
+		for ( i = factorization.Split; i > memory && pred(y[i], x[i]); --i ) {
+			
+		} //for ( i = factorization.Split; i > memory && pred(y[i], x[i]); --i )
+		
+		if ( i <= memory ) {
+			return y;
+		} //if ( i <= memory )
+		
+		j += factorization.Period;
+		if ( factorization.Periodic ) {
+			memory = m - factorization.Period - 1;
+		} //if ( factorization.Periodic )
+	} //for ( DistType j = 0; j <= n - m; )
+	return last;
+}
+
+/**
+ * @brief Patterns from this length on are searched with the Two-Way algorithm by constexprStd::search, for shorter ones
+ *        the factorization does not pay off.
+ */
+constexpr inline std::ptrdiff_t TwoWayMinLength = 16;
+
+/**
+ * @brief The goto and fail automaton of the Aho-Corasick searcher in flat arrays, one entry per node.
+ *
+ * Every distinct prefix of the patterns is a node, the root is node 0. The nodes are numbered breadth first, so the
+ * children of a node are consecutive and sorted by cmp. For byte sized elements compared with < the children of the
+ * root, which are looked up most, are also held in a flat table, it is used for texts with the same element type.
+ */
+template<typename T, std::size_t MaxNodes, typename Compare>
+class AhoCorasickAutomaton {
+	private:
+	static_assert(MaxNodes > 0 && MaxNodes <= std::numeric_limits<std::uint32_t>::max());
+	
+	using Index = std::conditional_t<(MaxNodes <= std::numeric_limits<std::uint16_t>::max()), std::uint16_t,
+	                                 std::uint32_t>;
+	
+	static constexpr bool HasRootTable = IsByteLike<T>::value &&
+	                                     std::disjunction_v<std::is_same<Compare, std::less<>>,
+	                                                        std::is_same<Compare, std::less<T>>>;
+	
+	T Labels[MaxNodes]                      = {};
+	Index ChildBegin[MaxNodes + 1]          = {};
+	Index Fail[MaxNodes]                    = {};
+	//The nearest node with a pattern on the fail chain, starting at the node itself, 0 if there is none
+	Index Match[MaxNodes]                   = {};
+	Index Depth[MaxNodes]                   = {};
+	std::size_t Patterns[MaxNodes]          = {};
+	Index RootTable[HasRootTable ? 256 : 1] = {};
+	std::size_t Count                       = 1;
+	Compare Cmp;
+	
+	template<typename U>
+	[[nodiscard]] constexpr std::size_t child(const std::size_t node, const U& value) const
+			noexcept(noexcept(Cmp(Labels[0], value)) && noexcept(Cmp(value, Labels[0]))) {
+		if constexpr ( HasRootTable && std::is_same_v<std::remove_cv_t<U>, T> ) {
+			//Other types could be truncated by the cast, they are compared like on the deeper nodes
+			if ( node == 0 ) {
+				return RootTable[static_cast<unsigned char>(value)];
+			} //if ( node == 0 )
+		} //if constexpr ( HasRootTable && std::is_same_v<std::remove_cv_t<U>, T> )
+		
+		const std::size_t end = ChildBegin[node + 1];
+		std::size_t first = ChildBegin[node], length = end - first;
+		while ( length > 0 ) {
+			const std::size_t half = length / 2;
+			if ( Cmp(Labels[first + half], value) ) {
+				first  += half + 1;
+				length -= half + 1;
+			} //if ( Cmp(Labels[first + half], value) )
+			else {
+				length = half;
+			} //else -> if ( Cmp(Labels[first + half], value) )
+		} //while ( length > 0 )
+		return first != end && !Cmp(value, Labels[first]) ? first : 0;
+	}
+	
+	public:
+	static constexpr std::size_t NoPattern = std::numeric_limits<std::size_t>::max();
+	
+	/**
+	 * @brief Builds the automaton of the patterns [patternsFirst, patternsLast), each one a range of elements.
+	 * @throw std::length_error If the patterns need more than MaxNodes nodes, which is a compile error in a constant
+	 *                          expression.
+	 */
+	template<typename ForwardIter>
+	constexpr AhoCorasickAutomaton(ForwardIter patternsFirst, const ForwardIter patternsLast, Compare cmp) :
+			Cmp(std::move(cmp)) {
+		//Build the trie with lists of children, sorted by their labels
+		T label[MaxNodes]             = {};
+		Index firstChild[MaxNodes]    = {};
+		Index sibling[MaxNodes]       = {};
+		std::size_t pattern[MaxNodes] = {};
+		for ( auto& p : pattern ) {
+			p = NoPattern;
+		} //for ( auto& p : pattern )
+		
+		for ( std::size_t index = 0; patternsFirst != patternsLast; ++patternsFirst, ++index ) {
+			std::size_t node = 0;
+			for ( const auto& value : *patternsFirst ) {
+				Index *link = &firstChild[node];
+				while ( *link != 0 && Cmp(label[*link], value) ) {
+					link = &sibling[*link];
+				} //while ( *link != 0 && Cmp(label[*link], value) )
+				
+				if ( *link == 0 || Cmp(value, label[*link]) ) {
+					if ( Count == MaxNodes ) {
+						throw std::length_error{"constexprStd::aho_corasick_searcher: More nodes than MaxNodes"};
+					} //if ( Count == MaxNodes )
+					label[Count]   = value;
+					sibling[Count] = *link;
+					*link          = static_cast<Index>(Count++);
+				} //if ( *link == 0 || Cmp(value, label[*link]) )
+				node = *link;
+			} //for ( const auto& value : *patternsFirst )
+			
+			//Empty patterns are ignored, equal ones keep the first index
+			if ( node != 0 && pattern[node] == NoPattern ) {
+				pattern[node] = index;
+			} //if ( node != 0 && pattern[node] == NoPattern )
+		} //for ( std::size_t index = 0; patternsFirst != patternsLast; ++patternsFirst, ++index )
+		
+		//Number the nodes breadth first, order maps the new numbers to the old ones
+		Index order[MaxNodes] = {};
+		std::size_t tail = 1;
+		for ( std::size_t node = 0; node < Count; ++node ) {
+			Labels[node]     = label[order[node]];
+			Patterns[node]   = pattern[order[node]];
+			ChildBegin[node] = static_cast<Index>(tail);
+			for ( Index old = firstChild[order[node]]; old != 0; old = sibling[old] ) {
+				Depth[tail]   = static_cast<Index>(Depth[node] + 1);
+				order[tail++] = old;
+			} //for ( Index old = firstChild[order[node]]; old != 0; old = sibling[old] )
+		} //for ( std::size_t node = 0; node < Count; ++node )
+		ChildBegin[Count] = static_cast<Index>(Count);
+		
+		if constexpr ( HasRootTable ) {
+			for ( std::size_t node = ChildBegin[0]; node < ChildBegin[1]; ++node ) {
+				RootTable[static_cast<unsigned char>(Labels[node])] = static_cast<Index>(node);
+			} //for ( std::size_t node = ChildBegin[0]; node < ChildBegin[1]; ++node )
+		} //if constexpr ( HasRootTable )
+		
+		//The fail target is shallower than the node, so it is complete when we get to the node
+		for ( std::size_t node = 0; node < Count; ++node ) {
+			for ( std::size_t next = ChildBegin[node]; next < ChildBegin[node + 1]; ++next ) {
+				const std::size_t fail = node == 0 ? 0 : step(Fail[node], Labels[next]);
+				Fail[next]  = static_cast<Index>(fail);
+				Match[next] = Patterns[next] != NoPattern ? static_cast<Index>(next) : Match[fail];
+			} //for ( std::size_t next = ChildBegin[node]; next < ChildBegin[node + 1]; ++next )
+		} //for ( std::size_t node = 0; node < Count; ++node )
+		return;
+	}
+	
+	/**
+	 * @brief The node reached from node by value, following the fail links until it can be read.
+	 */
+	template<typename U>
+	[[nodiscard]] constexpr std::size_t step(std::size_t node, const U& value) const
+			noexcept(noexcept(std::declval<const AhoCorasickAutomaton&>().child(node, value))) {
+		for ( ; ; node = Fail[node] ) {
+			if ( const std::size_t next = child(node, value); next != 0 || node == 0 ) {
+				return next;
+			} //if ( const std::size_t next = child(node, value); next != 0 || node == 0 )
+		} //for ( ; ; node = Fail[node] )
+	}
+	
+	/**
+	 * @brief The deepest node with a pattern which ends at node, 0 if there is none.
+	 */
+	[[nodiscard]] constexpr std::size_t firstMatch(const std::size_t node) const noexcept {
+		return Match[node];
+	}
+	
+	/**
+	 * @brief The next shorter node with a pattern after the matching node.
+	 */
+	[[nodiscard]] constexpr std::size_t nextMatch(const std::size_t node) const noexcept {
+		return Match[Fail[node]];
+	}
+	
+	[[nodiscard]] constexpr std::size_t pattern(const std::size_t node) const noexcept {
+		return Patterns[node];
+	}
+	
+	[[nodiscard]] constexpr std::size_t depth(const std::size_t node) const noexcept {
+		return Depth[node];
+	}
+	
+	[[nodiscard]] constexpr std::size_t size(void) const noexcept {
+		return Count;
+	}
+};
+
+template<typename BinaryPredicate, typename T>
+struct IsEqualTo : std::disjunction<std::is_same<BinaryPredicate, std::equal_to<>>,
+                                    std::is_same<BinaryPredicate, std::equal_to<T>>,
+                                    std::is_same<BinaryPredicate, cmp::Equal>> { };
+
+/**
+ * @brief The bad character table of the Boyer-Moore searchers. The tables group the elements by their value or by <,
+ *        which is only correct if pred is the equality and the < equivalence of the elements is the equality, too.
+ */
+template<typename RandIter, typename BinaryPredicate,
+         typename T = std::remove_cv_t<typename std::iterator_traits<RandIter>::value_type>>
+using BadCharacterTable = std::conditional_t<std::conjunction_v<IsEqualTo<BinaryPredicate, T>,
+                                                                IsLessEquivalenceEqual<T>>,
+                                             HorspoolTable<RandIter>, HorspoolUnitTable<RandIter>>;
+
+/**
+ * @brief If two ranges compared with pred can be handled by the algorithms which need an order: both have the same value
+ *        type, which is compared for equality and whose < equivalence is known to be the equality.
+ */
+template<typename Iter1, typename Iter2, typename BinaryPredicate,
+         typename T = std::remove_cv_t<typename std::iterator_traits<Iter1>::value_type>>
+struct IsOrderedEqual : std::conjunction<std::is_same<T,
+                                                      std::remove_cv_t<
+                                                      	typename std::iterator_traits<Iter2>::value_type>>,
+                                         IsEqualTo<BinaryPredicate, T>, IsLessEquivalenceEqual<T>> { };
+
+/**
+ * @brief If a search can use the algorithms which need an order (Two-Way, the Horspool tables), they also need random
+ *        access.
+ */
+template<typename Iter1, typename Iter2, typename BinaryPredicate>
+struct IsOrderedSearch : std::conjunction<IsRaIter<Iter1>, IsRaIter<Iter2>,
+                                          IsOrderedEqual<Iter1, Iter2, BinaryPredicate>> { };
 } //namespace constexprStd::details
 
 #endif
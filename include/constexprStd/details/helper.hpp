@@ -24,11 +24,20 @@
 #ifndef CONSTEXPRSTD_DETAILS_HELPER_HPP
 #define CONSTEXPRSTD_DETAILS_HELPER_HPP
 
+#include <cstdint>
 #include <iterator>
 #include <type_traits>
 
 #include <experimental/type_traits>
 
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define CONSTEXPRSTD_HAS_IS_CONSTANT_EVALUATED
+#endif
+#elif defined(__GNUC__) && __GNUC__ >= 9
+#define CONSTEXPRSTD_HAS_IS_CONSTANT_EVALUATED
+#endif
+
 namespace std {
 template<typename T1, typename T2>
 struct pair;
@@ -95,6 +104,54 @@ using IsSearcher = typename std::experimental::is_detected_exact<std::pair<Iter,
 template<typename T, typename Iter>
 constexpr inline auto IsSearcherV = IsSearcher<T, Iter>::value;
 
+/**
+ * @brief If two values of T which are neither less than the other are known to be equal.
+ *
+ * This does not hold for floating point types (NaN) or for a < which only compares a part of the object, so only
+ * integral and enumeration types qualify. Pointers are left out, because < is no constant expression for pointers to
+ * different objects.
+ */
+template<typename T>
+struct IsLessEquivalenceEqual : std::disjunction<std::is_integral<T>, std::is_enum<T>> { };
+
+template<typename T>
+struct IsNothrowLessComparable : std::bool_constant<noexcept(std::declval<const T&>() < std::declval<const T&>())> { };
+
+/**
+ * @brief If out[0] = *in does not throw, as a class so the expression is only checked where it is needed.
+ */
+template<typename OutIter, typename InIter>
+struct IsNothrowIndexAssignable : std::bool_constant<noexcept(std::declval<OutIter&>()[0] =
+                                                              *std::declval<InIter&>())> { };
+
+/**
+ * @brief The number of trailing zero bits of a non zero word.
+ */
+constexpr int countTrailingZeros(std::uint64_t word) noexcept {
+#if defined(__GNUC__)
+	return __builtin_ctzll(word);
+#else
+	int ret = 0;
+	for ( ; (word & 1) == 0; word >>= 1 ) {
+		++ret;
+	} //for ( ; (word & 1) == 0; word >>= 1 )
+	return ret;
+#endif
+}
+
+/**
+ * @brief Checks if the call happens within a constant evaluation.
+ * @return If we are evaluated at compile time. If the compiler does not tell us, we always claim to be, so the constexpr
+ *         code path is taken.
+ */
+constexpr bool isConstantEvaluated(void) noexcept {
+#ifdef CONSTEXPRSTD_HAS_IS_CONSTANT_EVALUATED
+	return __builtin_is_constant_evaluated();
+#else
+	return true;
+#endif
+}
+
 struct EnableDefaultCtorTag {
 	explicit constexpr EnableDefaultCtorTag(void) = default;
 };
@@ -0,0 +1,140 @@
+/**
+ ** This file is part of the constexprStd project.
+ ** Copyright 2017 Björn Schäpers <bjoern@hazardy.de>.
+ **
+ ** This program is free software: you can redistribute it and/or modify
+ ** it under the terms of the GNU Lesser General Public License as
+ ** published by the Free Software Foundation, either version 3 of the
+ ** License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ ** GNU Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public License
+ ** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/**
+ * @file
+ * @brief Contains the slots shared by the fixed size allocators.
+ */
+
+#ifndef CONSTEXPRSTD_DETAILS_MEMORY_HPP
+#define CONSTEXPRSTD_DETAILS_MEMORY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "helper.hpp"
+#include "uninitialized.hpp"
+
+namespace constexprStd::details {
+/**
+ * @brief The N slots of an allocator and everything which only needs to know to which slot a pointer belongs. How the
+ *        slots are handed out is up to the derived allocator, if it has no free slot it uses std::allocator.
+ */
+template<typename T, std::size_t N>
+class AllocatorSlots {
+	public:
+	using value_type         = T;
+	using pointer            = value_type*;
+	using const_pointer      = typename std::pointer_traits<pointer>::template rebind<const value_type>;
+	using const_void_pointer = typename std::pointer_traits<pointer>::template rebind<const void>;
+	using size_type          = std::size_t;
+	
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::false_type;
+	using propagate_on_container_swap            = std::false_type;
+	
+	protected:
+	using ArrayType = std::array<Uninitialized<T>, N>;
+	
+	ArrayType Memory{};
+	
+	static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+	
+	constexpr AllocatorSlots(void) noexcept = default;
+	
+	[[nodiscard]] constexpr std::size_t findPtrPos(const const_pointer ptr, const std::size_t hint = 0) const noexcept {
+		if ( !details::isConstantEvaluated() ) {
+			/* At runtime the position follows from the address, compared as integers because the pointer may come
+			 * from the fallback allocation and thus be unrelated to our memory. */
+			const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+			const auto begin   = reinterpret_cast<std::uintptr_t>(Memory.data());
+			if ( address < begin || address - begin >= sizeof(ArrayType) ) {
+				return npos;
+			} //if ( address < begin || address - begin >= sizeof(ArrayType) )
+			return (address - begin) / sizeof(typename ArrayType::value_type);
+		} //if ( !details::isConstantEvaluated() )
+		
+		/* In a constant evaluation there is no fallback allocation, so the pointer is one of ours and can be compared
+		 * with the slots. The compiler is not happy about the arithmetic between the pointers, but it orders
+		 * pointers to different elements of the same array, so we search the slot with a binary search. */
+		if ( hint < N && slotPointer(hint) == ptr ) {
+			return hint;
+		} //if ( hint < N && slotPointer(hint) == ptr )
+		
+		std::size_t first = 0, length = N;
+		while ( length > 0 ) {
+			const std::size_t half = length / 2;
+			if ( slotPointer(first + half) < ptr ) {
+				first  += half + 1;
+				length -= half + 1;
+			} //if ( slotPointer(first + half) < ptr )
+			else {
+				length = half;
+			} //else -> if ( slotPointer(first + half) < ptr )
+		} //while ( length > 0 )
+		return first != N && slotPointer(first) == ptr ? first : npos;
+	}
+	
+	[[nodiscard]] constexpr pointer slotPointer(const std::size_t pos) noexcept {
+		return std::addressof(Memory[pos].get());
+	}
+	
+	[[nodiscard]] constexpr const_pointer slotPointer(const std::size_t pos) const noexcept {
+		return std::addressof(Memory[pos].get());
+	}
+	
+	public:
+	[[nodiscard]] constexpr pointer getPointer(const pointer ptr, const std::size_t offset,
+	                                           const std::size_t hint = 0) noexcept {
+		auto pos = findPtrPos(ptr, hint);
+		if ( pos == npos ) {
+			return ptr + offset;
+		} //if ( pos == npos )
+		return slotPointer(pos + offset);
+	}
+	
+	template<typename... Args>
+	constexpr void construct(const pointer ptr, Args&&... args) {
+		const auto pos = findPtrPos(ptr);
+		if ( pos == npos ) {
+			std::allocator<T>{}.construct(ptr, std::forward<Args>(args)...);
+		} //if ( pos == npos )
+		else {
+			Memory[pos].init(std::forward<Args>(args)...);
+		} //else -> if ( pos == npos )
+		return;
+	}
+	
+	constexpr void destroy(const pointer ptr) noexcept(std::is_nothrow_destructible_v<T>) {
+		const auto pos = findPtrPos(ptr);
+		if ( pos == npos ) {
+			std::allocator<T>{}.destroy(ptr);
+		} //if ( pos == npos )
+		else {
+			Memory[pos].deinit();
+		} //else -> if ( pos == npos )
+		return;
+	}
+};
+} //namespace constexprStd::details
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ ** This file is part of the constexprStd project.
+ ** Copyright 2017 Björn Schäpers <bjoern@hazardy.de>.
+ **
+ ** This program is free software: you can redistribute it and/or modify
+ ** it under the terms of the GNU Lesser General Public License as
+ ** published by the Free Software Foundation, either version 3 of the
+ ** License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ ** GNU Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public License
+ ** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/**
+ * @file
+ * @brief Contains details for the constexpr variants of <numeric>
+ */
+
+#ifndef CONSTEXPRSTD_DETAILS_NUMERIC_HPP
+#define CONSTEXPRSTD_DETAILS_NUMERIC_HPP
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "../iterator"
+
+namespace constexprStd::details {
+struct Identity {
+	template<typename T>
+	constexpr T&& operator()(T&& t) const noexcept {
+		return std::forward<T>(t);
+	}
+};
+
+/**
+ * @brief Reduces init and the n elements provided by element(i) with four independent accumulators.
+ *
+ * Every accumulator only depends on its own previous value, so the four chains can be executed in parallel by the CPU
+ * and a constant evaluation has only a quarter of the dependent steps. This reordering is only allowed, because op has
+ * to be associative and commutative for reduce.
+ */
+template<typename T, typename Dist, typename BinaryOp, typename Element>
+constexpr T reduceLanes(T init, const Dist n, BinaryOp& op, Element element)
+		noexcept(noexcept(init = op(std::move(init), element(n))) && noexcept(T(op(element(n), element(n)))) &&
+		         noexcept(op(std::move(init), std::move(init)))) {
+	constexpr Dist lanes = 4;
+	Dist i = 0;
+	
+	if ( n >= 2 * lanes ) {
+		T acc0 = op(element(0), element(1));
+		T acc1 = op(element(2), element(3));
+		T acc2 = op(element(4), element(5));
+		T acc3 = op(element(6), element(7));
+		
+		for ( i = 2 * lanes; n - i >= lanes; i += lanes ) {
+			acc0 = op(std::move(acc0), element(i));
+			acc1 = op(std::move(acc1), element(i + 1));
+			acc2 = op(std::move(acc2), element(i + 2));
+			acc3 = op(std::move(acc3), element(i + 3));
+		} //for ( i = 2 * lanes; n - i >= lanes; i += lanes )
+		
+		init = op(std::move(init), op(op(std::move(acc0), std::move(acc1)), op(std::move(acc2), std::move(acc3))));
+	} //if ( n >= 2 * lanes )
+	
+	for ( ; i < n; ++i ) {
+		init = op(std::move(init), element(i));
+	} //for ( ; i < n; ++i )
+	return init;
+}
+
+template<typename RandomAccessIter, typename T, typename BinaryOp, typename UnaryOp>
+constexpr T transformReduceImpl(const RandomAccessIter first, const RandomAccessIter last, T init, BinaryOp& reduceOp,
+                                UnaryOp& transformOp, const std::random_access_iterator_tag)
+		noexcept(noexcept(constexprStd::distance(first, last)) && std::is_nothrow_move_constructible_v<T> &&
+		         noexcept(init = reduceOp(std::move(init), transformOp(first[0]))) &&
+		         noexcept(T(reduceOp(transformOp(first[0]), transformOp(first[0])))) &&
+		         noexcept(reduceOp(std::move(init), std::move(init)))) {
+	return reduceLanes(std::move(init), constexprStd::distance(first, last), reduceOp,
+	                   [first,&transformOp](const auto i) constexpr -> decltype(auto) {
+	                   	return transformOp(first[i]);
+	                   });
+}
+
+template<typename InputIter, typename T, typename BinaryOp, typename UnaryOp>
+constexpr T transformReduceImpl(InputIter first, const InputIter last, T init, BinaryOp& reduceOp,
+                                UnaryOp& transformOp, const std::input_iterator_tag)
+		noexcept(noexcept(first != last) && noexcept(++first) &&
+		         noexcept(init = reduceOp(std::move(init), transformOp(*first))) &&
+		         std::is_nothrow_move_constructible_v<T>) {
+	for ( ; first != last; ++first ) {
+		init = reduceOp(std::move(init), transformOp(*first));
+	} //for ( ; first != last; ++first )
+	return init;
+}
+
+template<typename RandomAccessIter1, typename RandomAccessIter2, typename T, typename BinaryOp1, typename BinaryOp2>
+constexpr T transformReduceImpl(const RandomAccessIter1 first1, const RandomAccessIter1 last1,
+                                const RandomAccessIter2 first2, T init, BinaryOp1& reduceOp, BinaryOp2& transformOp,
+                                const std::random_access_iterator_tag, const std::random_access_iterator_tag)
+		noexcept(noexcept(constexprStd::distance(first1, last1)) && std::is_nothrow_move_constructible_v<T> &&
+		         noexcept(init = reduceOp(std::move(init), transformOp(first1[0], first2[0]))) &&
+		         noexcept(T(reduceOp(transformOp(first1[0], first2[0]), transformOp(first1[0], first2[0])))) &&
+		         noexcept(reduceOp(std::move(init), std::move(init)))) {
+	return reduceLanes(std::move(init), constexprStd::distance(first1, last1), reduceOp,
+	                   [first1,first2,&transformOp](const auto i) constexpr -> decltype(auto) {
+	                   	return transformOp(first1[i], first2[i]);
+	                   });
+}
+
+template<typename InputIter1, typename InputIter2, typename T, typename BinaryOp1, typename BinaryOp2>
+constexpr T transformReduceImpl(InputIter1 first1, const InputIter1 last1, InputIter2 first2, T init,
+                                BinaryOp1& reduceOp, BinaryOp2& transformOp, const std::input_iterator_tag,
+                                const std::input_iterator_tag)
+		noexcept(noexcept(first1 != last1) && noexcept(++first1, ++first2) &&
+		         noexcept(init = reduceOp(std::move(init), transformOp(*first1, *first2))) &&
+		         std::is_nothrow_move_constructible_v<T>) {
+	for ( ; first1 != last1; ++first1, ++first2 ) {
+		init = reduceOp(std::move(init), transformOp(*first1, *first2));
+	} //for ( ; first1 != last1; ++first1, ++first2 )
+	return init;
+}
+} //namespace constexprStd::details
+
+#endif
@@ -0,0 +1,165 @@
+/**
+ ** This file is part of the constexprStd project.
+ ** Copyright 2017 Björn Schäpers <bjoern@hazardy.de>.
+ **
+ ** This program is free software: you can redistribute it and/or modify
+ ** it under the terms of the GNU Lesser General Public License as
+ ** published by the Free Software Foundation, either version 3 of the
+ ** License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ ** GNU Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public License
+ ** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/**
+ * @file
+ * @brief Contains details for the constexpr variants of <random>
+ */
+
+#ifndef CONSTEXPRSTD_DETAILS_RANDOM_HPP
+#define CONSTEXPRSTD_DETAILS_RANDOM_HPP
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace constexprStd::details {
+template<typename U>
+struct WideProduct {
+	U High;
+	U Low;
+};
+
+constexpr WideProduct<std::uint32_t> multiplyWide(const std::uint32_t a, const std::uint32_t b) noexcept {
+	const std::uint64_t product = static_cast<std::uint64_t>(a) * b;
+	return {static_cast<std::uint32_t>(product >> 32), static_cast<std::uint32_t>(product)};
+}
+
+constexpr WideProduct<std::uint64_t> multiplyWide(const std::uint64_t a, const std::uint64_t b) noexcept {
+#ifdef __SIZEOF_INT128__
+	__extension__ using UInt128 = unsigned __int128;
+	const UInt128 product = static_cast<UInt128>(a) * b;
+	return {static_cast<std::uint64_t>(product >> 64), static_cast<std::uint64_t>(product)};
+#else
+	//Schoolbook multiplication with 32 bit halves, none of the sums can overflow
+	const std::uint64_t aLow = a & 0xFFFFFFFF, aHigh = a >> 32;
+	const std::uint64_t bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+	const std::uint64_t lowLow = aLow * bLow, highLow = aHigh * bLow;
+	const std::uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + aLow * bHigh;
+	return {aHigh * bHigh + (highLow >> 32) + (middle >> 32), a * b};
+#endif
+}
+
+/**
+ * @brief Lemire's nearly divisionless method, for a generator which produces all values of U.
+ * @return A uniformly distributed value in [0, range].
+ *
+ * The random number is multiplied with the size of the interval, the high half of the product is the result. Only if
+ * the low half falls into the small biased area we need the division to compute the rejection threshold.
+ */
+template<typename U, typename URBG>
+constexpr U lemire(URBG& g, const U range) noexcept(noexcept(g())) {
+	if ( range == std::numeric_limits<U>::max() ) {
+		return static_cast<U>(g());
+	} //if ( range == std::numeric_limits<U>::max() )
+	
+	const U size = range + 1;
+	auto product = multiplyWide(static_cast<U>(g()), size);
+	if ( product.Low < size ) {
+		const U threshold = static_cast<U>(U{0} - size) % size;
+		while ( product.Low < threshold ) {
+			product = multiplyWide(static_cast<U>(g()), size);
+		} //while ( product.Low < threshold )
+	} //if ( product.Low < size )
+	return product.High;
+}
+
+/**
+ * @brief Maps the output of an arbitrary generator to [0, range], by downscaling with rejection, or by combining
+ * multiple calls when the generator's range is too small.
+ */
+template<typename U, typename URBG>
+constexpr U uniformIntGeneric(URBG& g, const U range) noexcept(noexcept(g())) {
+	using Common = std::common_type_t<U, typename URBG::result_type>;
+	constexpr Common genMin   = URBG::min();
+	constexpr Common genRange = static_cast<Common>(URBG::max()) - genMin;
+	const Common wanted       = range;
+	
+	if ( genRange > wanted ) {
+		//Reject everything after the last complete bucket
+		const Common buckets = wanted + 1;
+		const Common scaling = genRange / buckets;
+		const Common past    = buckets * scaling;
+		Common ret           = static_cast<Common>(g()) - genMin;
+		while ( ret >= past ) {
+			ret = static_cast<Common>(g()) - genMin;
+		} //while ( ret >= past )
+		return static_cast<U>(ret / scaling);
+	} //if ( genRange > wanted )
+	
+	if ( genRange == wanted ) {
+		return static_cast<U>(static_cast<Common>(g()) - genMin);
+	} //if ( genRange == wanted )
+	
+	//The generator's range is too small, the high part is computed recursively
+	constexpr Common genBuckets = genRange + 1;
+	Common high = 0, ret = 0;
+	do { //while ( ret > wanted || ret < high )
+		high = genBuckets * static_cast<Common>(uniformIntGeneric(g, static_cast<U>(wanted / genBuckets)));
+		ret  = high + (static_cast<Common>(g()) - genMin);
+	} while ( ret > wanted || ret < high );
+	return static_cast<U>(ret);
+}
+
+/**
+ * @brief Returns a uniformly distributed value in [0, range].
+ *
+ * Generators producing all 32 or 64 bit values use Lemire's method, all others the generic way.
+ */
+template<typename U, typename URBG>
+constexpr U uniformInt(URBG& g, const U range) noexcept(noexcept(g())) {
+	using Common = std::common_type_t<U, typename URBG::result_type>;
+	constexpr bool fullRange = URBG::min() == 0;
+	constexpr Common genMax  = URBG::max();
+	
+	if constexpr ( fullRange && genMax == std::numeric_limits<std::uint64_t>::max() ) {
+		return static_cast<U>(lemire(g, static_cast<std::uint64_t>(range)));
+	} //if constexpr ( fullRange && genMax == std::numeric_limits<std::uint64_t>::max() )
+	else if constexpr ( fullRange && genMax == std::numeric_limits<std::uint32_t>::max() ) {
+		if ( range <= std::numeric_limits<std::uint32_t>::max() ) {
+			return static_cast<U>(lemire(g, static_cast<std::uint32_t>(range)));
+		} //if ( range <= std::numeric_limits<std::uint32_t>::max() )
+		return uniformIntGeneric(g, range);
+	} //else if constexpr ( fullRange && genMax == std::numeric_limits<std::uint32_t>::max() )
+	else {
+		return uniformIntGeneric(g, range);
+	} //else -> if constexpr ( fullRange && genMax == std::numeric_limits<std::uint64_t>::max() )
+}
+
+/**
+ * @brief Returns a uniformly distributed value in [a, b].
+ */
+template<typename IntType, typename URBG>
+constexpr IntType uniformIntBetween(URBG& g, const IntType a, const IntType b) noexcept(noexcept(g())) {
+	using U = std::conditional_t<(sizeof(IntType) <= sizeof(std::uint32_t)), std::uint32_t, std::uint64_t>;
+	const U range = static_cast<U>(static_cast<U>(b) - static_cast<U>(a));
+	return static_cast<IntType>(static_cast<U>(static_cast<U>(a) + uniformInt(g, range)));
+}
+
+/**
+ * @brief SplitMix64, used to expand a single seed into a whole state.
+ */
+constexpr std::uint64_t splitMix64(std::uint64_t& state) noexcept {
+	std::uint64_t z = (state += 0x9E3779B97F4A7C15);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+	return z ^ (z >> 31);
+}
+} //namespace constexprStd::details
+
+#endif
@@ -71,6 +71,8 @@ class TestConstexprStd : public QObject {
 	void testReverseCopy(void) const noexcept;
 	void testRotate(void) const noexcept;
 	void testRotateCopy(void) const noexcept;
+	void testShuffle(void) const noexcept;
+	void testSample(void) const noexcept;
 	void testUnique(void) const noexcept;
 	void testUniqueCopy(void) const noexcept;
 	
@@ -85,10 +87,18 @@ class TestConstexprStd : public QObject {
 	void testIsSortedUntil(void) const noexcept;
 	void testIsSorted(void) const noexcept;
 	void testSort(void) const noexcept;
+	void testSortRandom(void) const noexcept;
+	void testStableSort(void) const noexcept;
 	void testNthElement(void) const noexcept;
 	void testPartialSort(void) const noexcept;
 	void testPartialSortCopy(void) const noexcept;
 	
+	//Binary search operations (on sorted ranges)
+	void testLowerBound(void) const noexcept;
+	void testUpperBound(void) const noexcept;
+	void testBinarySearch(void) const noexcept;
+	void testEqualRange(void) const noexcept;
+	
 	//Heap operations
 	void testIsHeapUntil(void) const noexcept;
 	void testIsHeap(void) const noexcept;
@@ -101,12 +111,45 @@ class TestConstexprStd : public QObject {
 	//Set operations (on sorted ranges)
 	void testMerge(void) const noexcept;
 	void testMergeInplace(void) const noexcept;
+	void testIncludes(void) const noexcept;
+	void testSetDifference(void) const noexcept;
+	void testSetIntersection(void) const noexcept;
+	void testSetSymmetricDifference(void) const noexcept;
+	void testSetUnion(void) const noexcept;
 	
 	//Minimum/maximum operations
+	void testMax(void) const noexcept;
+	void testMaxElement(void) const noexcept;
+	void testMin(void) const noexcept;
+	void testMinElement(void) const noexcept;
+	void testMinmax(void) const noexcept;
+	void testMinmaxElement(void) const noexcept;
+	void testClamp(void) const noexcept;
 	void testLexicographicalCompare(void) const noexcept;
 	
 	//Permutations
 	void testIsPermutation(void) const noexcept;
+	void testNextPermutation(void) const noexcept;
+	void testPrevPermutation(void) const noexcept;
+	void testForEachPermutation(void) const noexcept;
+	
+	//Numeric operations
+	void testIota(void) const noexcept;
+	void testAccumulate(void) const noexcept;
+	void testInnerProduct(void) const noexcept;
+	void testAdjacentDifference(void) const noexcept;
+	void testPartialSum(void) const noexcept;
+	void testReduce(void) const noexcept;
+	void testExclusiveScan(void) const noexcept;
+	void testInclusiveScan(void) const noexcept;
+	void testTransformReduce(void) const noexcept;
+	void testTransformExclusiveScan(void) const noexcept;
+	void testTransformInclusiveScan(void) const noexcept;
+	
+	//Pseudo-random number generation
+	void testXoshiro256StarStar(void) const noexcept;
+	void testPcg32(void) const noexcept;
+	void testUniformIntDistribution(void) const noexcept;
 	
 	//Function objects
 	//Polymorphic function wrappers
@@ -117,6 +160,10 @@ class TestConstexprStd : public QObject {
 	
 	//Searcher
 	void testDefaultSeracher(void) const noexcept;
+	void testBoyerMooreSearcher(void) const noexcept;
+	void testBoyerMooreHorspoolSearcher(void) const noexcept;
+	void testTwoWaySearcher(void) const noexcept;
+	void testAhoCorasickSearcher(void) const noexcept;
 	
 	//Iterator lib
 	//Iterator adaptors
@@ -131,6 +178,7 @@ class TestConstexprStd : public QObject {
 	//Dynamic memory management
 	//Allocators
 	void testAllocator(void) const noexcept;
+	void testPoolAllocator(void) const noexcept;
 	
 	//Utility lib
 	void testBitset(void) const noexcept;
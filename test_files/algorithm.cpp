@@ -29,15 +29,25 @@
 #include "test_helper_functions.hpp"
 
 #include <constexprStd/functional>
+#include <constexprStd/random>
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <forward_list>
 #include <iterator>
+#include <limits>
+#include <list>
+#include <numeric>
 #include <random>
+#include <set>
 #include <sstream>
+#include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <QTest>
 
@@ -47,6 +57,90 @@ static constexpr void doubleValue(T& t) noexcept(noexcept(t += t)) {
 	return;
 }
 
+/**
+ * @brief A value whose < is finer than its ==, the equality only compares the key.
+ */
+struct CoarseEqual {
+	int Key;
+	int Detail;
+	
+	constexpr bool operator==(const CoarseEqual& that) const noexcept {
+		return Key == that.Key;
+	}
+	
+	constexpr bool operator<(const CoarseEqual& that) const noexcept {
+		return Key < that.Key || (Key == that.Key && Detail < that.Detail);
+	}
+};
+
+/**
+ * @brief Fills the text with random CoarseEqual and copies the keys of a part of it into the pattern, with other
+ *        details.
+ */
+static void makeCoarseSearch(std::mt19937& gen, std::vector<CoarseEqual>& text, std::vector<CoarseEqual>& pattern) {
+	std::uniform_int_distribution<int> value{0, 3};
+	for ( auto& element : text ) {
+		element = {value(gen) % 2, value(gen)};
+	} //for ( auto& element : text )
+	
+	const auto offset = std::uniform_int_distribution<std::size_t>{0, text.size() - pattern.size()}(gen);
+	for ( std::size_t i = 0; i < pattern.size(); ++i ) {
+		pattern[i] = {text[offset + i].Key, value(gen)};
+	} //for ( std::size_t i = 0; i < pattern.size(); ++i )
+	return;
+}
+
+/**
+ * @brief Compares the set operation with the one of the std, with inputs of very different sizes and input iterators.
+ * @return If all results are equal.
+ */
+template<typename StdOperation, typename Operation>
+static bool compareSetOperation(StdOperation stdOperation, Operation operation) {
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> element{0, 999};
+	
+	std::vector<int> v1, v2, s, c;
+	
+	for ( std::size_t i = 0; i < 50; ++i ) {
+		//Mostly very different sizes, so that the galloping kicks in
+		v1.resize(i % 2 ? 5 * i : 1000);
+		v2.resize(i % 3 ? 1000 : i);
+		std::generate(v1.begin(), v1.end(), [&](void) { return element(gen); });
+		std::generate(v2.begin(), v2.end(), [&](void) { return element(gen) % (i % 5 ? 1000 : 50); });
+		std::sort(v1.begin(), v1.end());
+		std::sort(v2.begin(), v2.end());
+		
+		s.clear();
+		c.clear();
+		stdOperation(v1.begin(), v1.end(), v2.begin(), v2.end(), std::back_inserter(s));
+		operation(v1.begin(), v1.end(), v2.begin(), v2.end(), std::back_inserter(c));
+		if ( s != c ) {
+			return false;
+		} //if ( s != c )
+		
+		s.clear();
+		c.clear();
+		stdOperation(v2.begin(), v2.end(), v1.begin(), v1.end(), std::back_inserter(s));
+		operation(v2.begin(), v2.end(), v1.begin(), v1.end(), std::back_inserter(c));
+		if ( s != c ) {
+			return false;
+		} //if ( s != c )
+		
+		std::ostringstream out1, out2;
+		std::copy(v1.begin(), v1.end(), std::ostream_iterator<int>{out1, " "});
+		std::copy(v2.begin(), v2.end(), std::ostream_iterator<int>{out2, " "});
+		std::istringstream in1{out1.str()}, in2{out2.str()};
+		
+		c.clear();
+		using streamIter = std::istream_iterator<int>;
+		operation(streamIter{in2}, streamIter{}, streamIter{in1}, streamIter{}, std::back_inserter(c));
+		if ( s != c ) {
+			return false;
+		} //if ( s != c )
+	} //for ( std::size_t i = 0; i < 50; ++i )
+	return true;
+}
+
 void TestConstexprStd::testAllAnyNone(void) const noexcept {
 	//We do not test constexprness, because we only use functions which are constexpr
 	TestContainer allOdd{1, 3, 5, 7, 9, 11, 13, 15, 17, 19};
@@ -211,6 +305,20 @@ void TestConstexprStd::testCount(void) const noexcept {
 	static_assert(constexprStd::count(c.begin(), c.end(), 2) == 1);
 	static_assert(constexprStd::count(c.begin(), c.end(), 17) == 0);
 	static_assert(constexprStd::count(c, 5) == 1);
+	
+	//At runtime contiguous ranges of integral elements are counted without the predicate
+	std::vector<int> ints(1000);
+	std::string string(1000, 'a');
+	for ( std::size_t i = 0; i < ints.size(); ++i ) {
+		ints[i]   = static_cast<int>(i % 7);
+		string[i] = static_cast<char>('a' + i % 5);
+	} //for ( std::size_t i = 0; i < ints.size(); ++i )
+	QCOMPARE(constexprStd::count(ints, 3), std::count(ints.begin(), ints.end(), 3));
+	QCOMPARE(constexprStd::count(ints.data() + 5, ints.data() + 995, 6), std::count(ints.begin() + 5, ints.end() - 5, 6));
+	QCOMPARE(constexprStd::count(ints, 7), 0);
+	QCOMPARE(constexprStd::count(string, 'c'), std::count(string.begin(), string.end(), 'c'));
+	QCOMPARE(constexprStd::count(string, 'c' + 256), 0);
+	return;
 }
 
 void TestConstexprStd::testCountIf(void) const noexcept {
@@ -259,6 +367,27 @@ void TestConstexprStd::testMismatch(void) const noexcept {
 	QCOMPARE(         std::mismatch(a1.begin(), a1.end(), a4.begin(), a4.end()), ma4);
 	QCOMPARE(constexprStd::mismatch(a1,                   a4.begin()),           ma4);
 	QCOMPARE(constexprStd::mismatch(a1,                   a4),                   ma4);
+	
+	//At runtime contiguous ranges of integral elements are compared with memcmp, check a mismatch at every position
+	std::vector<int> v1(700), v2;
+	std::string s1(700, 'x'), s2;
+	std::iota(v1.begin(), v1.end(), -350);
+	for ( std::size_t i = 0; i <= v1.size(); ++i ) {
+		v2 = v1;
+		s2 = s1;
+		if ( i < v2.size() ) {
+			v2[i] = 1000;
+			s2[i] = 'y';
+		} //if ( i < v2.size() )
+		
+		const auto half = static_cast<std::ptrdiff_t>(i / 2);
+		QCOMPARE(constexprStd::mismatch(v1, v2.begin()), std::mismatch(v1.begin(), v1.end(), v2.begin()));
+		QCOMPARE(constexprStd::mismatch(v1.begin(), v1.end(), v2.begin(), v2.begin() + half),
+		         std::mismatch(v1.begin(), v1.end(), v2.begin(), v2.begin() + half));
+		QCOMPARE(constexprStd::mismatch(s1, s2), std::mismatch(s1.begin(), s1.end(), s2.begin(), s2.end()));
+		QCOMPARE(constexprStd::mismatch(s2.data(), s2.data() + half, s1.data()),
+		         std::mismatch(s2.data(), s2.data() + half, s1.data()));
+	} //for ( std::size_t i = 0; i <= v1.size(); ++i )
 	return;
 }
 
@@ -376,6 +505,20 @@ void TestConstexprStd::testEqual(void) const noexcept {
 	QVERIFY(!(constexprStd::equal(cla, cc1)));
 	QVERIFY( (constexprStd::equal(cnl, cc1)));
 	QVERIFY(!(constexprStd::equal(cll, cc1)));
+	
+	//At runtime contiguous ranges of integral elements are compared with memcmp
+	std::vector<short> v1(300, 5), v2(300, 5);
+	QVERIFY(constexprStd::equal(v1, v2));
+	QVERIFY(!constexprStd::equal(v1, std::vector<short>(299, 5)));
+	for ( std::size_t i = 0; i < v1.size(); i += 7 ) {
+		const auto pos = static_cast<std::ptrdiff_t>(i);
+		v2[i] = 6;
+		QVERIFY(!constexprStd::equal(v1, v2));
+		QVERIFY(!constexprStd::equal(v1.cbegin(), v1.cend(), v2.data()));
+		QVERIFY( constexprStd::equal(v1.begin(), v1.begin() + pos, v2.begin()));
+		QVERIFY( constexprStd::equal(v1.data() + pos + 1, v1.data() + 300, v2.begin() + pos + 1));
+		v2[i] = 5;
+	} //for ( std::size_t i = 0; i < v1.size(); i += 7 )
 	return;
 }
 
@@ -502,6 +645,38 @@ void TestConstexprStd::testFind(void) const noexcept {
 	cp = constexprStd::find(l, bazString);
 	QVERIFY(cp != l.end());
 	QCOMPARE(*cp, bazString);
+	
+	//At runtime contiguous ranges of integral elements use memchr or vector registers, check every position
+	auto findEveryPosition = [](auto container) {
+		using T = typename decltype(container)::value_type;
+		const T *const data = container.data();
+		const auto size = static_cast<std::ptrdiff_t>(container.size());
+		for ( std::ptrdiff_t i = 0; i < size; ++i ) {
+			container[static_cast<std::size_t>(i)] = T{7};
+			QCOMPARE(constexprStd::find(container, T{7}) - container.begin(), i);
+			QCOMPARE(constexprStd::find(container.cbegin() + i / 2, container.cend(), T{7}) - container.cbegin(), i);
+			QCOMPARE(constexprStd::find(data, data + size, T{7}) - data, i);
+			QCOMPARE(constexprStd::find(data + i + 1, data + size, T{7}) - data, size);
+			container[static_cast<std::size_t>(i)] = T{1};
+		} //for ( std::ptrdiff_t i = 0; i < size; ++i )
+		QCOMPARE(constexprStd::find(container, T{7}), container.end());
+		return;
+	};
+	findEveryPosition(std::vector<unsigned char>(70, 1));
+	findEveryPosition(std::vector<short>(70, 1));
+	findEveryPosition(std::vector<unsigned int>(70, 1));
+	findEveryPosition(std::vector<long long>(70, 1));
+	findEveryPosition(std::string(70, '\1'));
+	findEveryPosition(std::u16string(70, u'\1'));
+	
+	//The value is compared with the elements, a value which is not representable is never found
+	const std::vector<signed char> signedChars{0, 1, -1, 2};
+	QCOMPARE(constexprStd::find(signedChars, -1) - signedChars.begin(), 2);
+	QCOMPARE(constexprStd::find(signedChars, 255), signedChars.end());
+	QCOMPARE(constexprStd::find(signedChars, 258), signedChars.end());
+	const std::vector<short> shorts{0, 1, -1, 2};
+	QCOMPARE(constexprStd::find(shorts, 65535), shorts.end());
+	QCOMPARE(constexprStd::find(shorts, 2L) - shorts.begin(), 3);
 	return;
 }
 
@@ -618,6 +793,35 @@ void TestConstexprStd::testFindEnd(void) const noexcept {
 	QCOMPARE(std::distance(l.begin(), constexprStd::find_end(l.begin(), l.end(), searchL4.begin(), searchL4.end())), d4);
 	QCOMPARE(std::distance(l.begin(), constexprStd::find_end(l.begin(), l.end(), searchL5.begin(), searchL5.end())), d5);
 	QCOMPARE(std::distance(l.begin(), constexprStd::find_end(l.begin(), l.end(), searchL3.end(),   searchL3.end())), d3);
+	
+	//Random access ranges of ordered elements use a reversed Horspool scan, compare both paths with the std
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> length{0, 200};
+	std::vector<char> v, pattern;
+	for ( int i = 0; i < 500; ++i ) {
+		//A small alphabet for many partial matches
+		std::uniform_int_distribution<int> element{'a', 'a' + 1 + i % 4};
+		auto randomElement = [&gen,&element](void) { return static_cast<char>(element(gen)); };
+		v.resize(static_cast<std::size_t>(length(gen)));
+		pattern.resize(static_cast<std::size_t>(length(gen) % (i % 3 ? 5 : 40)));
+		std::generate(v.begin(), v.end(), randomElement);
+		std::generate(pattern.begin(), pattern.end(), randomElement);
+		const std::forward_list<char> list(v.begin(), v.end());
+		
+		const auto expected = std::distance(v.begin(), std::find_end(v.begin(), v.end(), pattern.begin(), pattern.end()));
+		QCOMPARE(std::distance(v.begin(), constexprStd::find_end(v, pattern)), expected);
+		QCOMPARE(std::distance(v.begin(), constexprStd::find_end(v, pattern, std::not_fn(std::not_equal_to<>{}))),
+		         expected);
+		QCOMPARE(std::distance(list.begin(), constexprStd::find_end(list, pattern)), expected);
+	} //for ( int i = 0; i < 500; ++i )
+	
+	//A < which is finer than == must not be used
+	std::vector<CoarseEqual> text(200), coarsePattern(20);
+	for ( int i = 0; i < 2000; ++i ) {
+		makeCoarseSearch(gen, text, coarsePattern);
+		QVERIFY(constexprStd::find_end(text, coarsePattern) ==
+		        std::find_end(text.begin(), text.end(), coarsePattern.begin(), coarsePattern.end()));
+	} //for ( int i = 0; i < 2000; ++i )
 	return;
 }
 
@@ -659,6 +863,53 @@ void TestConstexprStd::testFindFirstOf(void) const noexcept {
 	QCOMPARE(std::distance(s.begin(), constexprStd::find_first_of(s.begin(), s.end(), searchS3.begin(), searchS3.end())), d3);
 	QCOMPARE(std::distance(s.begin(), constexprStd::find_first_of(s.begin(), s.end(), searchS4.begin(), searchS4.end())), d4);
 	QCOMPARE(std::distance(s.begin(), constexprStd::find_first_of(s.begin(), s.end(), searchS5.begin(), searchS5.end())), d5);
+	
+	//Byte sized elements are looked up in a set of all 256 values, also in constant evaluation
+	auto byteSet = [](void) constexpr noexcept {
+			constexpr std::string_view text{"key = value;next"};
+			constexpr std::string_view delimiters{";= \t"};
+			constexpr std::byte bytes[]{std::byte{0x10}, std::byte{0xF0}, std::byte{0x80}};
+			constexpr std::byte byteNeedles[]{std::byte{0x80}, std::byte{0xF0}};
+			auto b1 = constexprStd::distance(text.begin(), constexprStd::find_first_of(text, delimiters));
+			auto b2 = constexprStd::distance(text.begin(), constexprStd::find_first_of(text.substr(6), delimiters));
+			auto b3 = constexprStd::distance(std::begin(bytes), constexprStd::find_first_of(bytes, byteNeedles));
+			return std::tuple{b1, b2, b3};
+		};
+	static_assert(byteSet() == std::tuple{3, 11, 1});
+	
+	//At runtime contiguous ranges look up whole vector registers, check every position and all byte values
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> byte{0, 255};
+	std::uniform_int_distribution<int> needleCount{1, 20};
+	for ( int i = 0; i < 200; ++i ) {
+		std::string text(static_cast<std::size_t>(i), '\0');
+		std::string needles(static_cast<std::size_t>(needleCount(gen)), '\0');
+		for ( char& c : text ) {
+			c = static_cast<char>(byte(gen));
+		} //for ( char& c : text )
+		for ( char& c : needles ) {
+			c = static_cast<char>(byte(gen));
+		} //for ( char& c : needles )
+		
+		QCOMPARE(constexprStd::find_first_of(text, needles), std::find_first_of(text.begin(), text.end(),
+		                                                                         needles.begin(), needles.end()));
+		const std::vector<signed char> signedText(text.begin(), text.end());
+		const std::vector<signed char> signedNeedles(needles.begin(), needles.end());
+		QCOMPARE(constexprStd::find_first_of(signedText, signedNeedles),
+		         std::find_first_of(signedText.begin(), signedText.end(), signedNeedles.begin(), signedNeedles.end()));
+		
+		//Only a single element matches
+		if ( !text.empty() ) {
+			char other = 0;
+			for ( ; needles.find(other) != std::string::npos; ++other ) {
+				
+			} //for ( ; needles.find(other) != std::string::npos; ++other )
+			text.assign(text.size(), other);
+			const auto pos = static_cast<std::size_t>(byte(gen)) % text.size();
+			text[pos] = needles.back();
+			QCOMPARE(constexprStd::find_first_of(text, needles) - text.begin(), static_cast<std::ptrdiff_t>(pos));
+		} //if ( !text.empty() )
+	} //for ( int i = 0; i < 200; ++i )
 	return;
 }
 
@@ -709,6 +960,40 @@ void TestConstexprStd::testSearch(void) const noexcept {
 	
 	static_assert(lambda() == std::tuple{0, 4, 9});
 	
+	//Long patterns are searched with the Two-Way algorithm
+	auto longLambda = [](void) constexpr noexcept {
+			std::array<int, 100> a{};
+			std::array<int, 20> s{};
+			s.back() = 1;
+			a[90]    = 1;
+			auto d1 = constexprStd::distance(a.begin(), constexprStd::search(a, s));
+			a[90]   = 0;
+			auto d2 = constexprStd::distance(a.begin(), constexprStd::search(a, s));
+			return std::pair{d1, d2};
+		};
+	static_assert(longLambda() == std::pair{71L, 100L});
+	
+	//A < which is finer than == must not be used
+	auto coarseLambda = [](void) constexpr noexcept {
+			std::array<CoarseEqual, 40> a{};
+			std::array<CoarseEqual, 20> s{};
+			for ( int i = 0; i < 20; ++i ) {
+				s[static_cast<std::size_t>(i)] = {0, i};
+				a[static_cast<std::size_t>(i)] = {0, 20 - i};
+			} //for ( int i = 0; i < 20; ++i )
+			return constexprStd::distance(a.begin(), constexprStd::search(a, s));
+		};
+	static_assert(coarseLambda() == 0);
+	
+	std::mt19937 gen{std::random_device{}()};
+	std::vector<CoarseEqual> text(200), pattern(20);
+	for ( int i = 0; i < 2000; ++i ) {
+		makeCoarseSearch(gen, text, pattern);
+		const auto expected = std::search(text.begin(), text.end(), pattern.begin(), pattern.end());
+		QVERIFY(constexprStd::search(text.begin(), text.end(), pattern.begin(), pattern.end()) == expected);
+		QVERIFY(constexprStd::search(text, constexprStd::default_searcher{pattern}) == expected);
+	} //for ( int i = 0; i < 2000; ++i )
+	
 	std::string s = "123 hallo 123";
 	std::string s1 = "123";
 	std::string s2 = "l";
@@ -839,6 +1124,24 @@ void TestConstexprStd::testSearchN(void) const noexcept {
 	QCOMPARE(std::distance(s.begin(), constexprStd::search_n(s.begin(), s.end(), 6, 'o')), d6);
 	QCOMPARE(std::distance(s.begin(), constexprStd::search_n(s.begin(), s.end(), 7, 'o')), d7);
 	QCOMPARE(std::distance(s.begin(), constexprStd::search_n(s.begin(), s.end(), 8, 'o')), d8);
+	
+	//Random access iterators only probe every count-th element, compare that and the forward version against the std
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 300};
+	std::uniform_int_distribution<int> count{-1, 12};
+	std::vector<int> v;
+	for ( int i = 0; i < 500; ++i ) {
+		v.resize(static_cast<std::size_t>(elementCount(gen)));
+		//Mostly ones, with a varying amount of zeros, so there are runs of different lengths
+		std::bernoulli_distribution one{0.5 + (i % 5) / 10.};
+		std::generate(v.begin(), v.end(), [&gen,&one](void) { return one(gen) ? 1 : 0; });
+		const std::forward_list<int> list(v.begin(), v.end());
+		
+		const int n = count(gen);
+		const auto expected = std::distance(v.begin(), std::search_n(v.begin(), v.end(), n, 1));
+		QCOMPARE(std::distance(v.begin(), constexprStd::search_n(v, n, 1)), expected);
+		QCOMPARE(std::distance(list.begin(), constexprStd::search_n(list, n, 1)), expected);
+	} //for ( int i = 0; i < 500; ++i )
 	return;
 }
 
@@ -884,6 +1187,20 @@ void TestConstexprStd::testCopy(void) const noexcept {
 	
 	citer = constexprStd::copy(ba, citer);
 	QCOMPARE(cc, expected5);
+	
+	//At runtime contiguous ranges of trivially copyable elements are copied with memmove, also overlapping ones
+	std::vector<int> v(100);
+	std::iota(v.begin(), v.end(), 0);
+	QCOMPARE(constexprStd::copy(v.begin() + 10, v.end(), v.begin()) - v.begin(), 90);
+	QCOMPARE(v[0],  10);
+	QCOMPARE(v[89], 99);
+	QCOMPARE(v[90], 90);
+	QCOMPARE(constexprStd::copy(v.begin(), v.begin(), v.begin() + 5) - v.begin(), 5);
+	
+	const std::string string{"copied by memmove"};
+	char buffer[20] = {};
+	QCOMPARE(constexprStd::copy(string, std::begin(buffer)) - std::begin(buffer), 17);
+	QCOMPARE(std::string{buffer}, string);
 	return;
 }
 
@@ -941,6 +1258,15 @@ void TestConstexprStd::testCopyN(void) const noexcept {
 	siter =          std::copy_n(&ba[0], 2, siter);
 	QCOMPARE(cc, expected3);
 	QCOMPARE(sc, expected3);
+	
+	//At runtime contiguous ranges of trivially copyable elements are copied with memmove
+	const std::vector<short> source{1, 2, 3, 4, 5};
+	std::vector<short> destination(5);
+	QCOMPARE(constexprStd::copy_n(source.begin(), 0,  destination.begin()), destination.begin());
+	QCOMPARE(constexprStd::copy_n(source.begin(), -3, destination.begin()), destination.begin());
+	QCOMPARE(destination, std::vector<short>(5));
+	QCOMPARE(constexprStd::copy_n(source.begin() + 1, 4, destination.data()), destination.data() + 4);
+	QCOMPARE(destination, (std::vector<short>{2, 3, 4, 5, 0}));
 	return;
 }
 
@@ -966,6 +1292,15 @@ void TestConstexprStd::testCopyBackward(void) const noexcept {
 		QVERIFY(c == s);
 	} //for ( ; citer != cend && siter != send; ++citer, ++siter )
 	QVERIFY(std::all_of(c.begin(), c.end(), constexprStd::details::cmp::EqualToValue{1}));
+	
+	//At runtime contiguous ranges of trivially copyable elements are copied with memmove, also overlapping ones
+	std::vector<int> v(100);
+	std::iota(v.begin(), v.end(), 0);
+	QCOMPARE(constexprStd::copy_backward(v.begin(), v.end() - 10, v.end()) - v.begin(), 10);
+	QCOMPARE(v[9],  9);
+	QCOMPARE(v[10], 0);
+	QCOMPARE(v[99], 89);
+	QCOMPARE(constexprStd::copy_backward(v.data(), v.data(), v.data() + 5), v.data() + 5);
 	return;
 }
 
@@ -1020,6 +1355,19 @@ void TestConstexprStd::testMove(void) const noexcept {
 	QVERIFY(!std::all_of(std::begin(sfs), std::end(sfs), isEmpty));
 	QVERIFY(std::is_permutation(cts.begin(), cts.end(), ca.begin(), ca.end()));
 	QVERIFY(std::is_permutation(sts.begin(), sts.end(), sa.begin(), sa.end()));
+	
+	//At runtime contiguous ranges of trivially copyable elements are moved with memmove
+	struct Point {
+		int X;
+		int Y;
+	};
+	std::vector<Point> points{{1, 2}, {3, 4}, {5, 6}}, movedPoints(3);
+	QCOMPARE(constexprStd::move(points, movedPoints.begin()), movedPoints.end());
+	QCOMPARE(movedPoints[2].X, 5);
+	QCOMPARE(movedPoints[2].Y, 6);
+	QCOMPARE(constexprStd::move(points.begin() + 1, points.end(), points.begin()), points.begin() + 2);
+	QCOMPARE(points[0].X, 3);
+	QCOMPARE(points[1].Y, 6);
 	return;
 }
 
@@ -1033,6 +1381,11 @@ void TestConstexprStd::testMoveBackward(void) const noexcept {
 	
 	QCOMPARE(c, expected);
 	QCOMPARE(s, expected);
+	
+	//At runtime contiguous ranges of trivially copyable elements are moved with memmove
+	std::vector<double> v{1., 2., 3., 4., 5.};
+	QCOMPARE(constexprStd::move_backward(v.begin(), v.begin() + 3, v.end()), v.begin() + 2);
+	QCOMPARE(v, (std::vector<double>{1., 2., 1., 2., 3.}));
 	return;
 }
 
@@ -1053,6 +1406,21 @@ void TestConstexprStd::testFill(void) const noexcept {
 	constexprStd::details::cmp::EqualToValue is22{22};
 	QVERIFY(std::all_of(std::begin(c), std::end(c), is22));
 	QVERIFY(std::all_of(std::begin(s), std::end(s), is22));
+	
+	//At runtime contiguous ranges are filled with memset or doubling memcpys, check that every element is set
+	for ( std::size_t size = 0; size < 70; ++size ) {
+		std::string string(size + 1, 'a');
+		std::vector<long long> longs(size + 1, 1);
+		constexprStd::fill(string.begin(), string.end() - 1, 'b');
+		constexprStd::fill(longs.data(), longs.data() + size, -5LL);
+		QCOMPARE(string, std::string(size, 'b') + 'a');
+		QCOMPARE(std::count(longs.begin(), longs.end(), -5LL), static_cast<std::ptrdiff_t>(size));
+		QCOMPARE(longs.back(), 1LL);
+	} //for ( std::size_t size = 0; size < 70; ++size )
+	
+	std::vector<double> doubles(100000);
+	constexprStd::fill(doubles, 2.5);
+	QCOMPARE(std::count(doubles.begin(), doubles.end(), 2.5), 100000);
 	return;
 }
 
@@ -1079,6 +1447,14 @@ void TestConstexprStd::testFillN(void) const noexcept {
 	
 	QCOMPARE(std::count(std::begin(c), std::end(c), 88), 23);
 	QCOMPARE(std::count(std::begin(s), std::end(s), 88), 23);
+	
+	//At runtime contiguous ranges are filled with memset or doubling memcpys
+	std::vector<unsigned char> bytes(10);
+	QCOMPARE(constexprStd::fill_n(bytes.begin(), -1, std::uint8_t{7}), bytes.begin());
+	QCOMPARE(constexprStd::fill_n(bytes.begin(), 6, std::uint8_t{7}), bytes.begin() + 6);
+	QCOMPARE(bytes, (std::vector<unsigned char>{7, 7, 7, 7, 7, 7, 0, 0, 0, 0}));
+	QCOMPARE(constexprStd::fill_n(std::begin(c), 40, 99) - std::begin(c), 40);
+	QCOMPARE(std::count(std::begin(c), std::end(c), 99), 40);
 	return;
 }
 
@@ -1458,6 +1834,120 @@ void TestConstexprStd::testRotateCopy(void) const noexcept {
 	return;
 }
 
+void TestConstexprStd::testShuffle(void) const noexcept {
+	constexpr TestContainer c;
+	
+	auto shuffled = [](auto g) constexpr noexcept {
+			TestContainer ret;
+			constexprStd::shuffle(ret.begin(), ret.end(), g);
+			return ret;
+		};
+	
+	constexpr auto s1 = shuffled(constexprStd::pcg32{});
+	constexpr auto s2 = shuffled(constexprStd::pcg32{});
+	constexpr auto s3 = shuffled(constexprStd::xoshiro256starstar{});
+	static_assert(constexprStd::is_permutation(s1, c));
+	static_assert(constexprStd::is_permutation(s3, c));
+	static_assert(s1 == s2);
+	static_assert(!(s1 == c));
+	static_assert(!(s3 == c));
+	
+	constexpr auto empty{[](void) constexpr noexcept {
+			std::array<int, 0> a{};
+			constexprStd::xoshiro256starstar g;
+			constexprStd::shuffle(a, g);
+			return a.size();
+		}()};
+	static_assert(empty == 0);
+	
+	//All 6 permutations of 3 elements should be equally likely
+	std::random_device rd;
+	constexprStd::xoshiro256starstar g{(static_cast<std::uint64_t>(rd()) << 32) | rd()};
+	std::array<int, 6> counts{};
+	for ( int i = 0; i < 60000; ++i ) {
+		std::array a{0, 1, 2};
+		constexprStd::shuffle(a, g);
+		++counts[static_cast<std::size_t>(a[0] * 2 + (a[1] > a[2]))];
+	} //for ( int i = 0; i < 60000; ++i )
+	
+	for ( const int count : counts ) {
+		QVERIFY(count > 9400 && count < 10600);
+	} //for ( const int count : counts )
+	
+	std::vector<int> v(1000);
+	std::iota(v.begin(), v.end(), 0);
+	auto copy = v;
+	constexprStd::shuffle(v.begin(), v.end(), g);
+	QVERIFY(std::is_permutation(v.begin(), v.end(), copy.begin(), copy.end()));
+	QVERIFY(v != copy);
+	return;
+}
+
+void TestConstexprStd::testSample(void) const noexcept {
+	constexpr TestContainer c;
+	
+	//Selection sampling keeps the order
+	constexpr auto s1{[c](void) constexpr noexcept {
+			std::array<int, 10> ret{};
+			constexprStd::pcg32 g;
+			const auto end = constexprStd::sample(c.begin(), c.end(), ret.begin(), 4, g);
+			return std::pair{ret, constexprStd::distance(ret.begin(), end)};
+		}()};
+	static_assert(s1.second == 4);
+	static_assert(constexprStd::is_sorted(s1.first.begin(), s1.first.begin() + 4));
+	static_assert(constexprStd::includes(c.begin(), c.end(), s1.first.begin(), s1.first.begin() + 4));
+	
+	constexpr auto s2{[c](void) constexpr noexcept {
+			std::array<int, 12> ret{};
+			const auto end = constexprStd::sample(c, ret.begin(), 12, constexprStd::xoshiro256starstar{});
+			return std::pair{ret, constexprStd::distance(ret.begin(), end)};
+		}()};
+	static_assert(s2.second == 10);
+	static_assert(constexprStd::equal(s2.first.begin(), s2.first.begin() + 10, c.begin(), c.end()));
+	
+	std::random_device rd;
+	constexprStd::pcg32 g{rd(), rd()};
+	
+	//Every 2-subset of 4 elements should be equally likely, for forward and input iterators
+	std::forward_list<int> population{0, 1, 2, 3};
+	std::array<int, 16> forwardCounts{}, inputCounts{};
+	for ( int i = 0; i < 60000; ++i ) {
+		std::array<int, 2> chosen{};
+		QCOMPARE(constexprStd::sample(population, chosen.begin(), 2, g), chosen.end());
+		QVERIFY(chosen[0] < chosen[1]);
+		++forwardCounts[static_cast<std::size_t>(chosen[0] * 4 + chosen[1])];
+		
+		std::istringstream stream{"0 1 2 3"};
+		QCOMPARE(constexprStd::sample(std::istream_iterator<int>{stream}, std::istream_iterator<int>{}, chosen.begin(),
+		                              2, g), chosen.end());
+		QVERIFY(chosen[0] != chosen[1]);
+		++inputCounts[static_cast<std::size_t>(std::min(chosen[0], chosen[1]) * 4 + std::max(chosen[0], chosen[1]))];
+	} //for ( int i = 0; i < 60000; ++i )
+	
+	for ( int first = 0; first < 4; ++first ) {
+		for ( int second = first + 1; second < 4; ++second ) {
+			const auto index = static_cast<std::size_t>(first * 4 + second);
+			QVERIFY(forwardCounts[index] > 9400 && forwardCounts[index] < 10600);
+			QVERIFY(inputCounts[index] > 9400 && inputCounts[index] < 10600);
+		} //for ( int second = first + 1; second < 4; ++second )
+	} //for ( int first = 0; first < 4; ++first )
+	
+	//Short input
+	std::istringstream stream{"5 6"};
+	std::array<int, 4> chosen{};
+	QCOMPARE(constexprStd::sample(std::istream_iterator<int>{stream}, std::istream_iterator<int>{}, chosen.begin(), 4,
+	                              g), chosen.begin() + 2);
+	QVERIFY(chosen[0] == 5 && chosen[1] == 6);
+	
+	//A forward population only needs an output iterator
+	std::vector<int> appended;
+	constexprStd::sample(population.begin(), population.end(), std::back_inserter(appended), 3, g);
+	QCOMPARE(appended.size(), std::size_t{3});
+	QVERIFY(std::is_sorted(appended.begin(), appended.end()));
+	QVERIFY(std::includes(population.begin(), population.end(), appended.begin(), appended.end()));
+	return;
+}
+
 void TestConstexprStd::testUnique(void) const noexcept {
 	constexpr std::array<int, 16> from     {1, 3, 1, 1, 4, 3, 4, 4, 5, 7, 7, 5, 2, 2, 9, 4};
 	constexpr std::array<int, 12> expected1{1, 3, 1, 4, 3, 4, 5, 7, 5, 2, 9, 4};
@@ -1739,6 +2229,49 @@ void TestConstexprStd::testStablePartition(void) const noexcept {
 	QVERIFY(*siter1 == *citer1);
 	QVERIFY(*siter2 == *citer2);
 	QVERIFY(*siter3 == *citer3);
+	
+	//Large enough for a quadratic number of moves to exceed the constexpr limits
+	constexpr auto partitioned = [](void) constexpr noexcept {
+			std::array<int, 4000> ret{};
+			for ( int i = 0; i < 4000; ++i ) {
+				ret[static_cast<std::size_t>(i)] = 4000 - i;
+			} //for ( int i = 0; i < 4000; ++i )
+			constexprStd::stable_partition(ret, isOdd);
+			return ret;
+		}();
+	static_assert(constexprStd::is_partitioned(partitioned, isOdd));
+	static_assert(partitioned[0] == 3999 && partitioned[1999] == 1 && partitioned[2000] == 4000 &&
+	              partitioned[3999] == 2);
+	
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 1000};
+	std::uniform_int_distribution<int> element{0, 999};
+	
+	std::vector<int> sv, cv;
+	std::list<int> cl;
+	for ( int i = 0; i < 20; ++i ) {
+		sv.clear();
+		const int numberOfElements = elementCount(gen);
+		for ( int j = 0; j < numberOfElements; ++j ) {
+			sv.push_back(element(gen));
+		} //for ( int j = 0; j < numberOfElements; ++j )
+		cv = sv;
+		cl.assign(sv.begin(), sv.end());
+		
+		const auto sSplit = std::distance(sv.begin(), std::stable_partition(sv.begin(), sv.end(), isOdd));
+		
+		count = 0;
+		const auto cSplit = std::distance(cv.begin(), constexprStd::stable_partition(cv, pred));
+		QVERIFY(sv == cv);
+		QCOMPARE(sSplit, cSplit);
+		QCOMPARE(count, numberOfElements);
+		
+		count = 0;
+		const auto lSplit = std::distance(cl.begin(), constexprStd::stable_partition(cl.begin(), cl.end(), pred));
+		QVERIFY(std::equal(sv.begin(), sv.end(), cl.begin(), cl.end()));
+		QCOMPARE(sSplit, lSplit);
+		QCOMPARE(count, numberOfElements);
+	} //for ( int i = 0; i < 20; ++i )
 	return;
 }
 
@@ -1809,6 +2342,142 @@ void TestConstexprStd::testSort(void) const noexcept {
 	QVERIFY(std::is_sorted(sOdd.begin(), sOdd.end()));
 	QVERIFY(std::is_sorted(cOdd.begin(), cOdd.end()));
 	QVERIFY(sOdd == cOdd);
+	
+	//Large enough to not only use the insertion sort
+	auto sortAndCheck = [](auto a) constexpr noexcept {
+			constexprStd::sort(a);
+			return constexprStd::is_sorted(a);
+		};
+	auto generate = [](auto f) constexpr noexcept {
+			std::array<int, 200> ret{};
+			for ( int i = 0; i < 200; ++i ) {
+				ret[static_cast<std::size_t>(i)] = f(i);
+			} //for ( int i = 0; i < 200; ++i )
+			return ret;
+		};
+	
+	constexpr auto sorted     = generate([](const int i) constexpr noexcept { return i; });
+	constexpr auto reversed   = generate([](const int i) constexpr noexcept { return 200 - i; });
+	constexpr auto duplicates = generate([](const int i) constexpr noexcept { return (i * 37) % 5; });
+	constexpr auto organPipe  = generate([](const int i) constexpr noexcept { return i < 100 ? i : 200 - i; });
+	constexpr auto scrambled  = generate([](const int i) constexpr noexcept { return (i * 7919) % 211; });
+	static_assert(sortAndCheck(sorted));
+	static_assert(sortAndCheck(reversed));
+	static_assert(sortAndCheck(duplicates));
+	static_assert(sortAndCheck(organPipe));
+	static_assert(sortAndCheck(scrambled));
+	static_assert(sortAndCheck(generate([](const int) constexpr noexcept { return 5; })));
+	return;
+}
+
+void TestConstexprStd::testSortRandom(void) const noexcept {
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 500};
+	std::uniform_int_distribution<int> element{0, 999};
+	
+	std::vector<int> s, c;
+	
+	for ( int i = 0; i < 50; ++i ) {
+		s.clear();
+		const int numberOfElements = elementCount(gen);
+		//Vary the number of distinct elements, to get some with many duplicates
+		const int modulo = i % 2 ? 1000 : 1 + i;
+		for ( int j = 0; j < numberOfElements; ++j ) {
+			s.push_back(element(gen) % modulo);
+		} //for ( int j = 0; j < numberOfElements; ++j )
+		
+		c = s;
+		std::sort(s.begin(), s.end());
+		constexprStd::sort(c);
+		QVERIFY(s == c);
+		
+		//Now sort an already sorted and a reversed range
+		constexprStd::sort(c);
+		QVERIFY(s == c);
+		
+		std::reverse(c.begin(), c.end());
+		constexprStd::sort(c);
+		QVERIFY(s == c);
+		
+		std::reverse(c.begin(), c.end());
+		constexprStd::sort(c, std::greater<>{});
+		QVERIFY(std::is_sorted(c.begin(), c.end(), std::greater<>{}));
+	} //for ( int i = 0; i < 50; ++i )
+	return;
+}
+
+void TestConstexprStd::testStableSort(void) const noexcept {
+	struct Element {
+		int Key;
+		int Index;
+	};
+	
+	auto byKey = [](const Element& e1, const Element& e2) constexpr noexcept { return e1.Key < e2.Key; };
+	
+	auto generate = [](auto f) constexpr noexcept {
+			std::array<Element, 200> ret{};
+			for ( int i = 0; i < 200; ++i ) {
+				ret[static_cast<std::size_t>(i)] = {f(i), i};
+			} //for ( int i = 0; i < 200; ++i )
+			return ret;
+		};
+	
+	auto isStableSorted = [](const auto& c) constexpr noexcept {
+			for ( std::size_t i = 1; i < c.size(); ++i ) {
+				if ( c[i - 1].Key > c[i].Key || (c[i - 1].Key == c[i].Key && c[i - 1].Index > c[i].Index) ) {
+					return false;
+				} //if ( c[i - 1].Key > c[i].Key || (c[i - 1].Key == c[i].Key && c[i - 1].Index > c[i].Index) )
+			} //for ( std::size_t i = 1; i < c.size(); ++i )
+			return true;
+		};
+	
+	auto sortAndCheck = [byKey,isStableSorted](auto a) constexpr noexcept {
+			constexprStd::stable_sort(a, byKey);
+			return isStableSorted(a);
+		};
+	
+	static_assert(sortAndCheck(generate([](const int i) constexpr noexcept { return i; })));
+	static_assert(sortAndCheck(generate([](const int i) constexpr noexcept { return 200 - i; })));
+	static_assert(sortAndCheck(generate([](const int i) constexpr noexcept { return (i * 37) % 5; })));
+	static_assert(sortAndCheck(generate([](const int i) constexpr noexcept { return i < 100 ? i : 200 - i; })));
+	static_assert(sortAndCheck(generate([](const int i) constexpr noexcept { return (i * 7919) % 211; })));
+	static_assert(sortAndCheck(generate([](const int i) constexpr noexcept { return (200 - i) / 3; })));
+	static_assert(sortAndCheck(generate([](const int) constexpr noexcept { return 5; })));
+	
+	constexpr auto small{[](void) constexpr noexcept {
+			std::array<int, 11> ret{9, 23, 41, 55, 777, 1024, 3, 5, 6, 2, 4};
+			constexprStd::stable_sort(ret.begin(), ret.end());
+			return ret;
+		}()};
+	static_assert(constexprStd::is_sorted(small));
+	
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 2000};
+	std::uniform_int_distribution<int> element{0, 999};
+	
+	std::vector<Element> s, c;
+	
+	for ( int i = 0; i < 50; ++i ) {
+		s.clear();
+		const int numberOfElements = elementCount(gen);
+		const int modulo = i % 2 ? 1000 : 1 + i;
+		for ( int j = 0; j < numberOfElements; ++j ) {
+			s.push_back({element(gen) % modulo, j});
+		} //for ( int j = 0; j < numberOfElements; ++j )
+		
+		c = s;
+		constexprStd::stable_sort(c, byKey);
+		QVERIFY(isStableSorted(c));
+		
+		//Partially sorted input, to get some natural runs
+		std::sort(s.begin(), std::next(s.begin(), numberOfElements / 2), byKey);
+		for ( int j = 0; j < numberOfElements; ++j ) {
+			s[static_cast<std::size_t>(j)].Index = j;
+		} //for ( int j = 0; j < numberOfElements; ++j )
+		c = s;
+		constexprStd::stable_sort(c.begin(), c.end(), byKey);
+		QVERIFY(isStableSorted(c));
+	} //for ( int i = 0; i < 50; ++i )
 	return;
 }
 
@@ -1930,6 +2599,107 @@ void TestConstexprStd::testPartialSortCopy(void) const noexcept {
 	return;
 }
 
+void TestConstexprStd::testLowerBound(void) const noexcept {
+	constexpr std::array<int, 10> a{1, 2, 2, 2, 5, 6, 6, 8, 9, 9};
+	
+	static_assert(constexprStd::lower_bound(a, 0) == a.begin());
+	static_assert(constexprStd::lower_bound(a, 2) == constexprStd::next(a.begin(), 1));
+	static_assert(constexprStd::lower_bound(a, 3) == constexprStd::next(a.begin(), 4));
+	static_assert(constexprStd::lower_bound(a, 9) == constexprStd::next(a.begin(), 8));
+	static_assert(constexprStd::lower_bound(a, 10) == a.end());
+	static_assert(constexprStd::lower_bound(a.rbegin(), a.rend(), 6, std::greater<>{}) ==
+	              constexprStd::next(a.rbegin(), 3));
+	
+	const std::forward_list<int> l{a.begin(), a.end()};
+	for ( int i = 0; i <= 10; ++i ) {
+		QCOMPARE(constexprStd::lower_bound(a.begin(), a.end(), i), std::lower_bound(a.begin(), a.end(), i));
+		QVERIFY(constexprStd::lower_bound(l, i) == std::lower_bound(l.begin(), l.end(), i));
+	} //for ( int i = 0; i <= 10; ++i )
+	
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 200};
+	std::uniform_int_distribution<int> element{0, 99};
+	
+	std::vector<int> v;
+	for ( int i = 0; i < 50; ++i ) {
+		v.resize(static_cast<std::size_t>(elementCount(gen)));
+		std::generate(v.begin(), v.end(), [&](void) { return element(gen); });
+		std::sort(v.begin(), v.end());
+		for ( int j = -1; j <= 100; ++j ) {
+			QVERIFY(constexprStd::lower_bound(v, j) == std::lower_bound(v.begin(), v.end(), j));
+		} //for ( int j = -1; j <= 100; ++j )
+	} //for ( int i = 0; i < 50; ++i )
+	return;
+}
+
+void TestConstexprStd::testUpperBound(void) const noexcept {
+	constexpr std::array<int, 10> a{1, 2, 2, 2, 5, 6, 6, 8, 9, 9};
+	
+	static_assert(constexprStd::upper_bound(a, 0) == a.begin());
+	static_assert(constexprStd::upper_bound(a, 2) == constexprStd::next(a.begin(), 4));
+	static_assert(constexprStd::upper_bound(a, 3) == constexprStd::next(a.begin(), 4));
+	static_assert(constexprStd::upper_bound(a, 9) == a.end());
+	static_assert(constexprStd::upper_bound(a.rbegin(), a.rend(), 6, std::greater<>{}) ==
+	              constexprStd::next(a.rbegin(), 5));
+	
+	const std::forward_list<int> l{a.begin(), a.end()};
+	for ( int i = 0; i <= 10; ++i ) {
+		QCOMPARE(constexprStd::upper_bound(a.begin(), a.end(), i), std::upper_bound(a.begin(), a.end(), i));
+		QVERIFY(constexprStd::upper_bound(l, i) == std::upper_bound(l.begin(), l.end(), i));
+	} //for ( int i = 0; i <= 10; ++i )
+	
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 200};
+	std::uniform_int_distribution<int> element{0, 99};
+	
+	std::vector<int> v;
+	for ( int i = 0; i < 50; ++i ) {
+		v.resize(static_cast<std::size_t>(elementCount(gen)));
+		std::generate(v.begin(), v.end(), [&](void) { return element(gen); });
+		std::sort(v.begin(), v.end());
+		for ( int j = -1; j <= 100; ++j ) {
+			QVERIFY(constexprStd::upper_bound(v, j) == std::upper_bound(v.begin(), v.end(), j));
+		} //for ( int j = -1; j <= 100; ++j )
+	} //for ( int i = 0; i < 50; ++i )
+	return;
+}
+
+void TestConstexprStd::testBinarySearch(void) const noexcept {
+	constexpr std::array<int, 10> a{1, 2, 2, 2, 5, 6, 6, 8, 9, 9};
+	
+	static_assert(!constexprStd::binary_search(a, 0));
+	static_assert( constexprStd::binary_search(a, 1));
+	static_assert( constexprStd::binary_search(a, 2));
+	static_assert(!constexprStd::binary_search(a, 3));
+	static_assert( constexprStd::binary_search(a, 9));
+	static_assert(!constexprStd::binary_search(a, 10));
+	static_assert( constexprStd::binary_search(a.rbegin(), a.rend(), 5, std::greater<>{}));
+	
+	const std::forward_list<int> l{a.begin(), a.end()};
+	for ( int i = 0; i <= 10; ++i ) {
+		QCOMPARE(constexprStd::binary_search(a.begin(), a.end(), i), std::binary_search(a.begin(), a.end(), i));
+		QCOMPARE(constexprStd::binary_search(l, i), std::binary_search(l.begin(), l.end(), i));
+	} //for ( int i = 0; i <= 10; ++i )
+	return;
+}
+
+void TestConstexprStd::testEqualRange(void) const noexcept {
+	constexpr std::array<int, 10> a{1, 2, 2, 2, 5, 6, 6, 8, 9, 9};
+	
+	static_assert(constexprStd::equal_range(a, 2) ==
+	              std::pair{constexprStd::next(a.begin(), 1), constexprStd::next(a.begin(), 4)});
+	static_assert(constexprStd::equal_range(a, 3) ==
+	              std::pair{constexprStd::next(a.begin(), 4), constexprStd::next(a.begin(), 4)});
+	static_assert(constexprStd::equal_range(a.begin(), a.end(), 9) == std::pair{constexprStd::next(a.begin(), 8), a.end()});
+	
+	const std::forward_list<int> l{a.begin(), a.end()};
+	for ( int i = 0; i <= 10; ++i ) {
+		QVERIFY(constexprStd::equal_range(a, i) == std::equal_range(a.begin(), a.end(), i));
+		QVERIFY(constexprStd::equal_range(l.begin(), l.end(), i) == std::equal_range(l.begin(), l.end(), i));
+	} //for ( int i = 0; i <= 10; ++i )
+	return;
+}
+
 void TestConstexprStd::testIsHeapUntil(void) const noexcept {
 	constexpr TestContainer cc;
 	
@@ -2087,6 +2857,345 @@ void TestConstexprStd::testMergeInplace(void) const noexcept {
 			return ret;
 		};
 	static_assert(l() == TestContainer{});
+	
+	//Large enough for the quadratic merge to exceed the constexpr limits
+	constexpr auto merged = [](void) constexpr noexcept {
+			std::array<int, 4000> ret{};
+			for ( int i = 0; i < 2000; ++i ) {
+				ret[static_cast<std::size_t>(i)]        = 2 * i + 1;
+				ret[static_cast<std::size_t>(i) + 2000] = 2 * i;
+			} //for ( int i = 0; i < 2000; ++i )
+			constexprStd::inplace_merge(ret.begin(), constexprStd::next(ret.begin(), 2000), ret.end());
+			return ret;
+		}();
+	static_assert(constexprStd::is_sorted(merged));
+	static_assert(merged[0] == 0 && merged[3999] == 3999);
+	
+	//Check the stability, elements with equal keys have to stay in the order of their indices
+	struct Element {
+		int Key;
+		int Index;
+	};
+	
+	auto byKey = [](const Element& e1, const Element& e2) constexpr noexcept { return e1.Key < e2.Key; };
+	auto isStableSorted = [](const auto& c) constexpr noexcept {
+			for ( std::size_t i = 1; i < c.size(); ++i ) {
+				if ( c[i - 1].Key > c[i].Key || (c[i - 1].Key == c[i].Key && c[i - 1].Index > c[i].Index) ) {
+					return false;
+				} //if ( c[i - 1].Key > c[i].Key || (c[i - 1].Key == c[i].Key && c[i - 1].Index > c[i].Index) )
+			} //for ( std::size_t i = 1; i < c.size(); ++i )
+			return true;
+		};
+	
+	constexpr auto stable = [byKey](const int split) constexpr noexcept {
+			std::array<Element, 100> ret{};
+			for ( int i = 0; i < 100; ++i ) {
+				const int key = i < split ? i / 7 : (i - split) / 3;
+				ret[static_cast<std::size_t>(i)] = {key, i};
+			} //for ( int i = 0; i < 100; ++i )
+			constexprStd::inplace_merge(ret.begin(), constexprStd::next(ret.begin(), split), ret.end(), byKey);
+			return ret;
+		};
+	static_assert(isStableSorted(stable(50)));
+	static_assert(isStableSorted(stable(20)));
+	static_assert(isStableSorted(stable(85)));
+	
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 1000};
+	std::uniform_int_distribution<int> element{0, 99};
+	
+	std::vector<Element> c;
+	std::list<Element> l2;
+	for ( int i = 0; i < 20; ++i ) {
+		const int count1 = elementCount(gen), count2 = elementCount(gen);
+		c.clear();
+		for ( int j = 0; j < count1 + count2; ++j ) {
+			c.push_back({element(gen), j});
+		} //for ( int j = 0; j < count1 + count2; ++j )
+		const auto middle = std::next(c.begin(), count1);
+		std::sort(c.begin(), middle, [](const Element& e1, const Element& e2) noexcept {
+				return e1.Key < e2.Key || (e1.Key == e2.Key && e1.Index < e2.Index);
+			});
+		std::sort(middle, c.end(), [](const Element& e1, const Element& e2) noexcept {
+				return e1.Key < e2.Key || (e1.Key == e2.Key && e1.Index < e2.Index);
+			});
+		l2.assign(c.begin(), c.end());
+		
+		constexprStd::inplace_merge(c.begin(), middle, c.end(), byKey);
+		QVERIFY(isStableSorted(c));
+		
+		constexprStd::inplace_merge(l2.begin(), std::next(l2.begin(), count1), l2.end(), byKey);
+		QVERIFY(std::equal(l2.begin(), l2.end(), c.begin(), c.end(), [](const Element& e1, const Element& e2) noexcept {
+				return e1.Index == e2.Index;
+			}));
+	} //for ( int i = 0; i < 20; ++i )
+	return;
+}
+
+void TestConstexprStd::testIncludes(void) const noexcept {
+	constexpr std::array<int, 10> a{1, 2, 2, 2, 5, 6, 6, 8, 9, 9};
+	constexpr std::array<int, 4> b1{2, 2, 6, 9}, b2{2, 2, 2, 2}, b3{0, 1, 2, 5}, b4{1, 5, 8, 9};
+	constexpr std::array<int, 0> empty{};
+	
+	static_assert( constexprStd::includes(a, b1));
+	static_assert(!constexprStd::includes(a, b2));
+	static_assert(!constexprStd::includes(a, b3));
+	static_assert( constexprStd::includes(a, b4));
+	static_assert( constexprStd::includes(a, empty));
+	static_assert(!constexprStd::includes(empty, b1));
+	static_assert( constexprStd::includes(a.rbegin(), a.rend(), b1.rbegin(), b1.rend(), std::greater<>{}));
+	
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> element{0, 99};
+	
+	std::vector<int> v1(1000), v2;
+	std::generate(v1.begin(), v1.end(), [&](void) { return element(gen); });
+	std::sort(v1.begin(), v1.end());
+	const std::forward_list<int> l{v1.begin(), v1.end()};
+	
+	for ( int i = 0; i < 50; ++i ) {
+		v2.resize(static_cast<std::size_t>(i));
+		std::generate(v2.begin(), v2.end(), [&](void) { return element(gen) + i / 10; });
+		std::sort(v2.begin(), v2.end());
+		
+		QCOMPARE(constexprStd::includes(v1, v2), std::includes(v1.begin(), v1.end(), v2.begin(), v2.end()));
+		QCOMPARE(constexprStd::includes(l, v2), std::includes(v1.begin(), v1.end(), v2.begin(), v2.end()));
+		QCOMPARE(constexprStd::includes(v2, v1), std::includes(v2.begin(), v2.end(), v1.begin(), v1.end()));
+	} //for ( int i = 0; i < 50; ++i )
+	return;
+}
+
+void TestConstexprStd::testSetDifference(void) const noexcept {
+	constexpr std::array<int, 10> a{1, 2, 2, 2, 5, 6, 6, 8, 9, 9};
+	constexpr std::array<int, 5> b{0, 2, 6, 7, 9};
+	
+	constexpr auto l = [a,b](void) constexpr noexcept {
+			std::array<int, 10> ret{};
+			constexprStd::set_difference(a, b, ret.begin());
+			return ret;
+		};
+	static_assert(constexprStd::equal(l(), std::array<int, 10>{1, 2, 2, 5, 6, 8, 9}));
+	
+	QVERIFY(compareSetOperation([](auto... args) { return std::set_difference(args...); },
+	                            [](auto... args) { return constexprStd::set_difference(args...); }));
+	return;
+}
+
+void TestConstexprStd::testSetIntersection(void) const noexcept {
+	constexpr std::array<int, 10> a{1, 2, 2, 2, 5, 6, 6, 8, 9, 9};
+	constexpr std::array<int, 5> b{0, 2, 6, 7, 9};
+	
+	constexpr auto l = [a,b](void) constexpr noexcept {
+			std::array<int, 10> ret{};
+			constexprStd::set_intersection(a, b, ret.begin());
+			return ret;
+		};
+	static_assert(constexprStd::equal(l(), std::array<int, 10>{2, 6, 9}));
+	
+	QVERIFY(compareSetOperation([](auto... args) { return std::set_intersection(args...); },
+	                            [](auto... args) { return constexprStd::set_intersection(args...); }));
+	return;
+}
+
+void TestConstexprStd::testSetSymmetricDifference(void) const noexcept {
+	constexpr std::array<int, 10> a{1, 2, 2, 2, 5, 6, 6, 8, 9, 9};
+	constexpr std::array<int, 5> b{0, 2, 6, 7, 9};
+	
+	constexpr auto l = [a,b](void) constexpr noexcept {
+			std::array<int, 15> ret{};
+			constexprStd::set_symmetric_difference(a, b, ret.begin());
+			return ret;
+		};
+	static_assert(constexprStd::equal(l(), std::array<int, 15>{0, 1, 2, 2, 5, 6, 7, 8, 9}));
+	
+	QVERIFY(compareSetOperation([](auto... args) { return std::set_symmetric_difference(args...); },
+	                            [](auto... args) { return constexprStd::set_symmetric_difference(args...); }));
+	return;
+}
+
+void TestConstexprStd::testSetUnion(void) const noexcept {
+	constexpr std::array<int, 10> a{1, 2, 2, 2, 5, 6, 6, 8, 9, 9};
+	constexpr std::array<int, 5> b{0, 2, 6, 7, 9};
+	
+	constexpr auto l = [a,b](void) constexpr noexcept {
+			std::array<int, 15> ret{};
+			constexprStd::set_union(a, b, ret.begin());
+			return ret;
+		};
+	static_assert(constexprStd::equal(l(), std::array<int, 15>{0, 1, 2, 2, 2, 5, 6, 6, 7, 8, 9, 9}));
+	
+	QVERIFY(compareSetOperation([](auto... args) { return std::set_union(args...); },
+	                            [](auto... args) { return constexprStd::set_union(args...); }));
+	return;
+}
+
+/**
+ * @brief Compares the element search with the one of the std, on a raw array, a vector, and a forward_list.
+ * @return If all results are equal.
+ */
+template<typename T, typename StdOperation, typename Operation>
+static bool compareElementSearch(StdOperation stdOperation, Operation operation) {
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 300};
+	std::uniform_int_distribution<int> element{-50, 50};
+	
+	std::vector<T> v;
+	std::forward_list<T> l;
+	for ( int i = 0; i < 100; ++i ) {
+		v.resize(static_cast<std::size_t>(elementCount(gen)));
+		std::generate(v.begin(), v.end(), [&](void) { return static_cast<T>(element(gen)); });
+		l.assign(v.begin(), v.end());
+		
+		const auto expected = stdOperation(v.begin(), v.end());
+		const T *const data = v.data();
+		if ( operation(data, data + v.size()) != expected(data) || operation(v.begin(), v.end()) != expected(v.begin()) ||
+		     operation(l.begin(), l.end()) != expected(l.begin()) ) {
+			return false;
+		} //if ( operation(data, data + v.size()) != expected(data) || ... )
+	} //for ( int i = 0; i < 100; ++i )
+	return true;
+}
+
+void TestConstexprStd::testMax(void) const noexcept {
+	constexpr std::pair<int, int> p1{1, 2}, p2{1, 3};
+	auto cmpFirst = [](const auto& a, const auto& b) constexpr noexcept { return a.first < b.first; };
+	
+	static_assert(constexprStd::max(1, 2) == 2);
+	static_assert(constexprStd::max(2, 1) == 2);
+	static_assert(constexprStd::max(1, 2, std::greater<>{}) == 1);
+	static_assert(constexprStd::max(p1, p2, cmpFirst).second == 2);
+	static_assert(constexprStd::max({3, 7, 1, 7, 5}) == 7);
+	static_assert(constexprStd::max({3, 7, 1, 7, 5}, std::greater<>{}) == 1);
+	QCOMPARE(&constexprStd::max(p1, p2, cmpFirst), &std::max(p1, p2, cmpFirst));
+	return;
+}
+
+void TestConstexprStd::testMaxElement(void) const noexcept {
+	constexpr TestContainer c{3, 7, 1, 7, 5, 2, 7, 0, 1, 3};
+	constexpr std::array<int, 0> empty{};
+	
+	static_assert(constexprStd::max_element(c) == constexprStd::next(c.begin(), 1));
+	static_assert(constexprStd::max_element(c, std::greater<>{}) == constexprStd::next(c.begin(), 7));
+	static_assert(constexprStd::max_element(empty) == empty.end());
+	
+	QVERIFY(compareElementSearch<int>([](auto first, auto last) {
+			const auto dist = std::distance(first, std::max_element(first, last));
+			return [dist](auto begin) { return std::next(begin, dist); };
+		}, [](auto first, auto last) { return constexprStd::max_element(first, last); }));
+	QVERIFY(compareElementSearch<double>([](auto first, auto last) {
+			const auto dist = std::distance(first, std::max_element(first, last));
+			return [dist](auto begin) { return std::next(begin, dist); };
+		}, [](auto first, auto last) { return constexprStd::max_element(first, last); }));
+	return;
+}
+
+void TestConstexprStd::testMin(void) const noexcept {
+	constexpr std::pair<int, int> p1{1, 2}, p2{1, 3};
+	auto cmpFirst = [](const auto& a, const auto& b) constexpr noexcept { return a.first < b.first; };
+	
+	static_assert(constexprStd::min(1, 2) == 1);
+	static_assert(constexprStd::min(2, 1) == 1);
+	static_assert(constexprStd::min(1, 2, std::greater<>{}) == 2);
+	static_assert(constexprStd::min(p1, p2, cmpFirst).second == 2);
+	static_assert(constexprStd::min({3, 7, 1, 7, 5}) == 1);
+	static_assert(constexprStd::min({3, 7, 1, 7, 5}, std::greater<>{}) == 7);
+	QCOMPARE(&constexprStd::min(p1, p2, cmpFirst), &std::min(p1, p2, cmpFirst));
+	return;
+}
+
+void TestConstexprStd::testMinElement(void) const noexcept {
+	constexpr TestContainer c{3, 7, 1, 7, 5, 2, 7, 0, 1, 0};
+	constexpr std::array<int, 0> empty{};
+	
+	static_assert(constexprStd::min_element(c) == constexprStd::next(c.begin(), 7));
+	static_assert(constexprStd::min_element(c, std::greater<>{}) == constexprStd::next(c.begin(), 1));
+	static_assert(constexprStd::min_element(empty) == empty.end());
+	
+	QVERIFY(compareElementSearch<int>([](auto first, auto last) {
+			const auto dist = std::distance(first, std::min_element(first, last));
+			return [dist](auto begin) { return std::next(begin, dist); };
+		}, [](auto first, auto last) { return constexprStd::min_element(first, last); }));
+	QVERIFY(compareElementSearch<float>([](auto first, auto last) {
+			const auto dist = std::distance(first, std::min_element(first, last));
+			return [dist](auto begin) { return std::next(begin, dist); };
+		}, [](auto first, auto last) { return constexprStd::min_element(first, last); }));
+	return;
+}
+
+void TestConstexprStd::testMinmax(void) const noexcept {
+	constexpr std::pair<int, int> p1{1, 2}, p2{1, 3};
+	auto cmpFirst = [](const auto& a, const auto& b) constexpr noexcept { return a.first < b.first; };
+	
+	static_assert(constexprStd::minmax(1, 2).first == 1 && constexprStd::minmax(1, 2).second == 2);
+	static_assert(constexprStd::minmax(2, 1).first == 1 && constexprStd::minmax(2, 1).second == 2);
+	static_assert(constexprStd::minmax(1, 2, std::greater<>{}).first == 2);
+	static_assert(constexprStd::minmax({3, 7, 1, 7, 5}) == std::pair{1, 7});
+	
+	const auto c = constexprStd::minmax(p1, p2, cmpFirst);
+	const auto s =          std::minmax(p1, p2, cmpFirst);
+	QCOMPARE(&c.first,  &s.first);
+	QCOMPARE(&c.second, &s.second);
+	return;
+}
+
+void TestConstexprStd::testMinmaxElement(void) const noexcept {
+	constexpr TestContainer c{3, 7, 1, 7, 5, 2, 7, 0, 1, 0};
+	constexpr std::array<int, 0> empty{};
+	
+	static_assert(constexprStd::minmax_element(c).first  == constexprStd::next(c.begin(), 7));
+	static_assert(constexprStd::minmax_element(c).second == constexprStd::next(c.begin(), 6));
+	static_assert(constexprStd::minmax_element(empty).first == empty.end());
+	
+	//We need at most 3 / 2 * n comparisons
+	int count = 0;
+	auto counter = [&count](const int a, const int b) noexcept { ++count; return a < b; };
+	for ( auto last = c.begin(); last != c.end(); ++last ) {
+		count = 0;
+		const auto s =          std::minmax_element(c.begin(), last);
+		const auto r = constexprStd::minmax_element(c.begin(), last, counter);
+		QVERIFY(s == r);
+		QVERIFY(count <= 3 * static_cast<int>(std::distance(c.begin(), last)) / 2);
+	} //for ( auto last = c.begin(); last != c.end(); ++last )
+	
+	auto expected = [](auto first, auto last) {
+			const auto [smallest, largest] = std::minmax_element(first, last);
+			return [min = std::distance(first, smallest), max = std::distance(first, largest)](auto begin) {
+					return std::pair{std::next(begin, min), std::next(begin, max)};
+				};
+		};
+	QVERIFY(compareElementSearch<int>(expected,
+	                                  [](auto first, auto last) { return constexprStd::minmax_element(first, last); }));
+	QVERIFY(compareElementSearch<double>(expected,
+	                                     [](auto first, auto last) { return constexprStd::minmax_element(first, last); }));
+	QVERIFY(compareElementSearch<unsigned char>(expected, [](auto first, auto last) {
+			return constexprStd::minmax_element(first, last);
+		}));
+	
+	//A NaN compares false with everything, the result depends on the order of the comparisons, which has to be the one
+	//of the std
+	const double nan = std::numeric_limits<double>::quiet_NaN();
+	std::vector<double> v1(64, 5.), v2{1., nan, 0.};
+	v1[1]  = nan;
+	v1[40] = 0.;
+	v1[50] = 9.;
+	for ( const auto& v : {v1, v2} ) {
+		const double *first = v.data(), *last = v.data() + v.size();
+		QCOMPARE(constexprStd::min_element(first, last), std::min_element(first, last));
+		QCOMPARE(constexprStd::max_element(first, last), std::max_element(first, last));
+		QVERIFY(constexprStd::minmax_element(first, last) == std::minmax_element(first, last));
+	} //for ( const auto& v : {v1, v2} )
+	return;
+}
+
+void TestConstexprStd::testClamp(void) const noexcept {
+	static_assert(constexprStd::clamp(5, 1, 10) == 5);
+	static_assert(constexprStd::clamp(0, 1, 10) == 1);
+	static_assert(constexprStd::clamp(11, 1, 10) == 10);
+	static_assert(constexprStd::clamp(5, 10, 1, std::greater<>{}) == 5);
+	static_assert(constexprStd::clamp(0, 10, 1, std::greater<>{}) == 1);
+	
+	const int v = 5, lo = 5, hi = 7;
+	QCOMPARE(&constexprStd::clamp(v, lo, hi), &std::clamp(v, lo, hi));
 	return;
 }
 
@@ -2232,6 +3341,36 @@ void TestConstexprStd::testLexicographicalCompare(void) const noexcept {
 	QCOMPARE(constexprStd::lexicographical_compare(s5.begin(), s5.end(), s3.begin(), s3.end()), b53);
 	QCOMPARE(constexprStd::lexicographical_compare(s5.begin(), s5.end(), s4.begin(), s4.end()), b54);
 	QCOMPARE(constexprStd::lexicographical_compare(s5.begin(), s5.end(), s5.begin(), s5.end()), b55);
+	
+	//At runtime contiguous ranges of integral elements search the difference with memcmp, compare that with the std
+	std::mt19937 gen{std::random_device{}()};
+	auto compareWithStd = [&gen](auto zero) {
+		using T = decltype(zero);
+		std::uniform_int_distribution<long long> element{std::numeric_limits<T>::min(), std::numeric_limits<T>::max()};
+		std::uniform_int_distribution<std::size_t> length{0, 600};
+		std::vector<T> v1, v2;
+		for ( int i = 0; i < 200; ++i ) {
+			v1.resize(length(gen));
+			std::generate(v1.begin(), v1.end(), [&gen,&element](void) { return static_cast<T>(element(gen)); });
+			//A prefix of v1, which is the common case for memcmp, and sometimes with one changed element
+			v2.assign(v1.begin(), v1.begin() + static_cast<std::ptrdiff_t>(length(gen) % (v1.size() + 1)));
+			if ( i % 2 && !v2.empty() ) {
+				v2[length(gen) % v2.size()] = static_cast<T>(element(gen));
+			} //if ( i % 2 && !v2.empty() )
+			
+			QCOMPARE(constexprStd::lexicographical_compare(v1, v2),
+			         std::lexicographical_compare(v1.begin(), v1.end(), v2.begin(), v2.end()));
+			QCOMPARE(constexprStd::lexicographical_compare(v2, v1),
+			         std::lexicographical_compare(v2.begin(), v2.end(), v1.begin(), v1.end()));
+		} //for ( int i = 0; i < 200; ++i )
+		return;
+	};
+	compareWithStd(static_cast<unsigned char>(0));
+	compareWithStd(static_cast<signed char>(0));
+	compareWithStd(char{0});
+	compareWithStd(short{0});
+	compareWithStd(0);
+	compareWithStd(0u);
 	return;
 }
 
@@ -2484,5 +3623,237 @@ void TestConstexprStd::testIsPermutation(void) const noexcept {
 	QVERIFY( constexprStd::is_permutation(l4, l6.begin(), sameParity));
 	QVERIFY( constexprStd::is_permutation(l4, l7.begin(), sameParity));
 	QVERIFY( constexprStd::is_permutation(l4, l8.begin(), sameParity));
+	
+	//Ordered elements are compared in chunks in a constant expression, use more elements than fit in one chunk
+	constexpr auto longLambda = [](const int swapWith, const int change) constexpr noexcept {
+		std::array<int, 1500> a{}, b{};
+		for ( std::size_t i = 0; i < a.size(); ++i ) {
+			//Many duplicates, which span over the chunk borders
+			a[i] = static_cast<int>(i * 7 % 301);
+			b[a.size() - 1 - i] = a[i];
+		} //for ( std::size_t i = 0; i < a.size(); ++i )
+		constexprStd::iter_swap(b.begin(), b.begin() + swapWith);
+		b[700] += change;
+		return std::pair{constexprStd::is_permutation(a, b), constexprStd::is_permutation(a, b.begin())};
+	};
+	static_assert(longLambda(1499, 0) == std::pair{true,  true});
+	static_assert(longLambda(  42, 0) == std::pair{true,  true});
+	static_assert(longLambda(   0, 1) == std::pair{false, false});
+	static_assert(longLambda( 900, 1) == std::pair{false, false});
+	
+	//At runtime ordered elements are sorted, compare that and the forward version against the std
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 1200};
+	std::vector<int> v1, v2;
+	for ( int i = 0; i < 300; ++i ) {
+		v1.resize(static_cast<std::size_t>(elementCount(gen)));
+		std::uniform_int_distribution<int> element{0, 1 + i % 50};
+		std::generate(v1.begin(), v1.end(), [&gen,&element](void) { return element(gen); });
+		v2 = v1;
+		std::shuffle(v2.begin(), v2.end(), gen);
+		if ( i % 2 && !v2.empty() ) {
+			//Change one element, which may or may not result in a permutation
+			v2[static_cast<std::size_t>(i) % v2.size()] = element(gen);
+		} //if ( i % 2 && !v2.empty() )
+		if ( i % 7 == 0 ) {
+			v2.push_back(element(gen));
+		} //if ( i % 7 == 0 )
+		const std::forward_list<int> list1(v1.begin(), v1.end()), list2(v2.begin(), v2.end());
+		
+		const bool expected = std::is_permutation(v1.begin(), v1.end(), v2.begin(), v2.end());
+		QCOMPARE(constexprStd::is_permutation(v1, v2), expected);
+		QCOMPARE(constexprStd::is_permutation(list1, list2), expected);
+		QCOMPARE(constexprStd::is_permutation(v1, list2, std::not_fn(std::not_equal_to<>{})), expected);
+		if ( v1.size() == v2.size() ) {
+			//The chunked version is otherwise only used in constant expressions, which can not be that large
+			QCOMPARE(constexprStd::details::isPermutationChunked(v1.begin(), v1.end(), list2.begin(), list2.end()),
+			         expected);
+		} //if ( v1.size() == v2.size() )
+	} //for ( int i = 0; i < 300; ++i )
+	
+	//A < which is finer than == must not be used, the details differ between the ranges
+	std::vector<CoarseEqual> c1(200), c2, unused(1);
+	std::uniform_int_distribution<int> detail{0, 3};
+	for ( int i = 0; i < 300; ++i ) {
+		makeCoarseSearch(gen, c1, unused);
+		c2 = c1;
+		for ( auto& element : c2 ) {
+			element.Detail = detail(gen);
+		} //for ( auto& element : c2 )
+		std::shuffle(c2.begin(), c2.end(), gen);
+		if ( i % 2 ) {
+			c2.front().Key ^= 1;
+		} //if ( i % 2 )
+		QCOMPARE(constexprStd::is_permutation(c1, c2), std::is_permutation(c1.begin(), c1.end(), c2.begin(), c2.end()));
+	} //for ( int i = 0; i < 300; ++i )
+	return;
+}
+
+void TestConstexprStd::testNextPermutation(void) const noexcept {
+	auto countPermutations = [](auto a, auto... cmp) constexpr noexcept {
+			int count = 1;
+			while ( constexprStd::next_permutation(a.begin(), a.end(), cmp...) ) {
+				++count;
+			} //while ( constexprStd::next_permutation(a.begin(), a.end(), cmp...) )
+			return std::pair{count, a};
+		};
+	
+	constexpr std::array sorted{1, 2, 3, 4, 5};
+	constexpr std::array duplicates{1, 1, 2, 2, 2, 3};
+	constexpr std::array descending{5, 4, 3, 2, 1};
+	
+	constexpr auto sortedResult = countPermutations(sorted);
+	constexpr auto duplicatesResult = countPermutations(duplicates);
+	constexpr auto descendingResult = countPermutations(descending, std::greater<>{});
+	static_assert(sortedResult.first == 120);
+	static_assert(constexprStd::equal(sortedResult.second, sorted));
+	static_assert(duplicatesResult.first == 60);
+	static_assert(constexprStd::equal(duplicatesResult.second, duplicates));
+	static_assert(descendingResult.first == 120);
+	static_assert(constexprStd::equal(descendingResult.second, descending));
+	static_assert(countPermutations(std::array<int, 0>{}).first == 1);
+	static_assert(countPermutations(std::array{7}).first == 1);
+	
+	constexpr auto last{[](void) constexpr noexcept {
+			std::array a{5, 4, 3, 2, 1};
+			const bool ret = constexprStd::next_permutation(a);
+			return std::pair{ret, a};
+		}()};
+	static_assert(!last.first);
+	static_assert(constexprStd::equal(last.second, sorted));
+	
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 7};
+	std::uniform_int_distribution<int> element{0, 4};
+	
+	for ( int i = 0; i < 20; ++i ) {
+		std::vector<int> s;
+		const int numberOfElements = elementCount(gen);
+		for ( int j = 0; j < numberOfElements; ++j ) {
+			s.push_back(element(gen));
+		} //for ( int j = 0; j < numberOfElements; ++j )
+		
+		std::list<int> c(s.begin(), s.end());
+		bool sRet, cRet;
+		do { //while ( sRet )
+			sRet = std::next_permutation(s.begin(), s.end());
+			cRet = constexprStd::next_permutation(c);
+			QCOMPARE(cRet, sRet);
+			QVERIFY(std::equal(s.begin(), s.end(), c.begin(), c.end()));
+		} while ( sRet );
+	} //for ( int i = 0; i < 20; ++i )
+	return;
+}
+
+void TestConstexprStd::testPrevPermutation(void) const noexcept {
+	auto countPermutations = [](auto a, auto... cmp) constexpr noexcept {
+			int count = 1;
+			while ( constexprStd::prev_permutation(a.begin(), a.end(), cmp...) ) {
+				++count;
+			} //while ( constexprStd::prev_permutation(a.begin(), a.end(), cmp...) )
+			return std::pair{count, a};
+		};
+	
+	constexpr std::array descending{5, 4, 3, 2, 1};
+	constexpr std::array duplicates{3, 2, 2, 2, 1, 1};
+	constexpr std::array sorted{1, 2, 3, 4, 5};
+	
+	constexpr auto descendingResult = countPermutations(descending);
+	constexpr auto duplicatesResult = countPermutations(duplicates);
+	constexpr auto sortedResult = countPermutations(sorted, std::greater<>{});
+	static_assert(descendingResult.first == 120);
+	static_assert(constexprStd::equal(descendingResult.second, descending));
+	static_assert(duplicatesResult.first == 60);
+	static_assert(constexprStd::equal(duplicatesResult.second, duplicates));
+	static_assert(sortedResult.first == 120);
+	static_assert(constexprStd::equal(sortedResult.second, sorted));
+	static_assert(countPermutations(std::array<int, 0>{}).first == 1);
+	
+	constexpr auto first{[](void) constexpr noexcept {
+			std::array a{1, 2, 3, 4, 5};
+			const bool ret = constexprStd::prev_permutation(a);
+			return std::pair{ret, a};
+		}()};
+	static_assert(!first.first);
+	static_assert(constexprStd::equal(first.second, descending));
+	
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 7};
+	std::uniform_int_distribution<int> element{0, 4};
+	
+	for ( int i = 0; i < 20; ++i ) {
+		std::vector<int> s;
+		const int numberOfElements = elementCount(gen);
+		for ( int j = 0; j < numberOfElements; ++j ) {
+			s.push_back(element(gen));
+		} //for ( int j = 0; j < numberOfElements; ++j )
+		
+		std::list<int> c(s.begin(), s.end());
+		bool sRet, cRet;
+		do { //while ( sRet )
+			sRet = std::prev_permutation(s.begin(), s.end());
+			cRet = constexprStd::prev_permutation(c);
+			QCOMPARE(cRet, sRet);
+			QVERIFY(std::equal(s.begin(), s.end(), c.begin(), c.end()));
+		} while ( sRet );
+	} //for ( int i = 0; i < 20; ++i )
+	return;
+}
+
+void TestConstexprStd::testForEachPermutation(void) const noexcept {
+	//Encodes every visited permutation of 0 .. 5 in base 6 and marks it
+	constexpr auto visited{[](void) constexpr noexcept {
+			struct Marker {
+				std::array<bool, 6 * 6 * 6 * 6 * 6 * 6> Seen{};
+				int Calls = 0;
+				
+				constexpr void operator()(const int *first, const int *last) noexcept {
+					int code = 0;
+					for ( ; first != last; ++first ) {
+						code = code * 6 + *first;
+					} //for ( ; first != last; ++first )
+					Seen[static_cast<std::size_t>(code)] = true;
+					++Calls;
+					return;
+				}
+			};
+			
+			std::array a{0, 1, 2, 3, 4, 5};
+			return constexprStd::for_each_permutation(a.data(), a.data() + a.size(), Marker{});
+		}()};
+	static_assert(visited.Calls == 720);
+	static_assert(constexprStd::count(visited.Seen, true) == 720);
+	
+	auto countCalls = [](auto a) constexpr noexcept {
+			int count = 0;
+			constexprStd::for_each_permutation(a, [&count](auto, auto) constexpr noexcept { ++count; return; });
+			return count;
+		};
+	static_assert(countCalls(std::array<int, 0>{}) == 1);
+	static_assert(countCalls(std::array{1}) == 1);
+	static_assert(countCalls(std::array{1, 2}) == 2);
+	static_assert(countCalls(std::array{1, 2, 3, 4, 5, 6, 7}) == 5040);
+	
+	//Equal elements are not skipped
+	static_assert(countCalls(std::array{1, 1, 1}) == 6);
+	
+	//Every permutation differs from the previous one by exactly one swap
+	std::vector<int> v{1, 2, 3, 4, 5, 6, 7, 8};
+	std::set<std::vector<int>> permutations;
+	std::vector<int> previous = v;
+	bool oneSwap = true;
+	constexprStd::for_each_permutation(v.begin(), v.end(),
+		[&](const auto first, const auto last) {
+			std::vector<int> current(first, last);
+			if ( !permutations.empty() ) {
+				oneSwap = oneSwap && std::inner_product(current.begin(), current.end(), previous.begin(), 0,
+				                                        std::plus<>{}, std::not_equal_to<>{}) == 2;
+			} //if ( !permutations.empty() )
+			permutations.insert(current);
+			previous = std::move(current);
+			return;
+		});
+	QCOMPARE(permutations.size(), static_cast<std::size_t>(40320));
+	QVERIFY(oneSwap);
 	return;
 }
@@ -25,13 +25,96 @@
 
 #include "../test.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include <constexprStd/iterator>
 
 #include "test_constants.hpp"
 #include "test_helper_functions.hpp"
 
+/**
+ * @brief Compares the searchers created by makeSearcher(patFirst, patLast) with std::search on random ranges.
+ * @param[in] alphabet The number of different elements, a small alphabet results in many partial matches.
+ */
+template<typename T, typename MakeSearcher>
+static void compareSearcher(const MakeSearcher makeSearcher, const int alphabet) {
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<std::size_t> haystackLength{0, 600};
+	std::uniform_int_distribution<std::size_t> patternLength{0, 300};
+	std::uniform_int_distribution<int> element{0, alphabet - 1};
+	auto randomElement = [&gen,&element](void) { return static_cast<T>(element(gen)); };
+	
+	std::vector<T> haystack, pattern;
+	for ( int i = 0; i < 300; ++i ) {
+		haystack.resize(haystackLength(gen));
+		std::generate(haystack.begin(), haystack.end(), randomElement);
+		
+		const std::size_t length = std::min(patternLength(gen), haystack.size());
+		if ( i % 2 ) {
+			//A pattern which is contained
+			const std::size_t start = std::uniform_int_distribution<std::size_t>{0, haystack.size() - length}(gen);
+			pattern.assign(haystack.begin() + static_cast<std::ptrdiff_t>(start),
+			               haystack.begin() + static_cast<std::ptrdiff_t>(start + length));
+		} //if ( i % 2 )
+		else {
+			pattern.resize(i % 4 ? length % 8 : length);
+			std::generate(pattern.begin(), pattern.end(), randomElement);
+		} //else -> if ( i % 2 )
+		
+		const auto s = std::search(haystack.begin(), haystack.end(), pattern.begin(), pattern.end());
+		const auto c = makeSearcher(pattern.begin(), pattern.end())(haystack.begin(), haystack.end());
+		QVERIFY(c.first == s);
+		QVERIFY(c.second == (s == haystack.end() ? s : s + static_cast<std::ptrdiff_t>(pattern.size())));
+	} //for ( int i = 0; i < 300; ++i )
+	return;
+}
+
+/**
+ * @brief Compares ASCII letters case insensitive, a predicate which is not the equality.
+ */
+struct CaseInsensitiveEqual {
+	static constexpr char lower(const char c) noexcept {
+		return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+	}
+	
+	constexpr bool operator()(const char a, const char b) const noexcept {
+		return lower(a) == lower(b);
+	}
+};
+
+/**
+ * @brief Searches case insensitive with the Searcher and compares with std::search.
+ */
+template<template<typename...> typename Searcher>
+static bool compareCaseInsensitiveSearch(void) {
+	const std::string haystack = "Here is a Simple Example, an EXAMPLE for the searcher";
+	for ( const std::string pattern : {"example", "EXAMPLE,", "here", "SEARCHER", "simple example", "is A"} ) {
+		const Searcher searcher{pattern.begin(), pattern.end(), std::hash<char>{}, CaseInsensitiveEqual{}};
+		const auto expected = std::search(haystack.begin(), haystack.end(), pattern.begin(), pattern.end(),
+		                                  CaseInsensitiveEqual{});
+		if ( searcher(haystack.begin(), haystack.end()).first != expected ) {
+			return false;
+		} //if ( searcher(haystack.begin(), haystack.end()).first != expected )
+	} //for ( const std::string pattern : {"example", "EXAMPLE,", "here", "SEARCHER", "simple example", "is A"} )
+	return true;
+}
+
+static constexpr char globalMarker[] = "<marker>";
+static constexpr constexprStd::boyer_moore_searcher globalSearcher{std::begin(globalMarker),
+                                                                   std::end(globalMarker) - 1};
+
+static constexpr std::string_view globalKeywords[]{"he", "she", "his", "hers"};
+static constexpr constexprStd::aho_corasick_searcher<char, 16> globalKeywordSearcher{globalKeywords};
+
 void TestConstexprStd::testInvoke(void) const noexcept {
 	struct Ackermann {
 		int N;
@@ -287,3 +370,271 @@ void TestConstexprStd::testDefaultSeracher(void) const noexcept {
 	QCOMPARE(std::distance(s.begin(), cp7.second), d72);
 	return;
 }
+
+void TestConstexprStd::testBoyerMooreHorspoolSearcher(void) const noexcept {
+	auto find = [](const auto& haystack, const auto& pattern) constexpr noexcept {
+			const constexprStd::boyer_moore_horspool_searcher searcher{pattern.begin(), pattern.end()};
+			const auto result = searcher(haystack.begin(), haystack.end());
+			return std::pair{result.first - haystack.begin(), result.second - haystack.begin()};
+		};
+	
+	using namespace std::string_view_literals;
+	constexpr auto text = "here is a simple example, an example for the searcher"sv;
+	static_assert(find(text, "example"sv) == std::pair{17L, 24L});
+	static_assert(find(text, "searcher"sv) == std::pair{45L, 53L});
+	static_assert(find(text, "here"sv) == std::pair{0L, 4L});
+	static_assert(find(text, "examples"sv) == std::pair{53L, 53L});
+	static_assert(find(text, ""sv) == std::pair{0L, 0L});
+	static_assert(find(""sv, "x"sv) == std::pair{0L, 0L});
+	
+	constexpr std::array bytes{std::byte{1}, std::byte{2}, std::byte{200}, std::byte{2}, std::byte{200}, std::byte{7}};
+	constexpr std::array bytePattern{std::byte{2}, std::byte{200}, std::byte{7}};
+	static_assert(find(bytes, bytePattern) == std::pair{3L, 6L});
+	
+	//Wider types use the sorted table
+	constexpr std::array ints{1, 2, 3, 1000, 2, 3, 1000, 2, 3, 1000, 5};
+	constexpr std::array intPattern{2, 3, 1000, 5};
+	static_assert(find(ints, intPattern) == std::pair{7L, 11L});
+	static_assert(find(ints, std::array{3, 1000, 2}) == std::pair{2L, 5L});
+	static_assert(find(ints, std::array{1000, 1000}) == std::pair{11L, 11L});
+	
+	//More different elements than the sorted table can hold
+	constexpr auto longFind{[find](void) constexpr noexcept {
+			std::array<int, 300> haystack{};
+			std::array<int, 100> pattern{};
+			for ( std::size_t i = 0; i < haystack.size(); ++i ) {
+				haystack[i] = static_cast<int>(i % 150);
+			} //for ( std::size_t i = 0; i < haystack.size(); ++i )
+			for ( std::size_t i = 0; i < pattern.size(); ++i ) {
+				pattern[i] = static_cast<int>(i + 40);
+			} //for ( std::size_t i = 0; i < pattern.size(); ++i )
+			return find(haystack, pattern);
+		}()};
+	static_assert(longFind == std::pair{40L, 140L});
+	
+	constexpr std::array searchIn{5, 4, 3, 2, 1, 2, 3};
+	constexpr std::array searchFor{2, 3};
+	static_assert(constexprStd::search(searchIn.begin(), searchIn.end(),
+	                                   constexprStd::boyer_moore_horspool_searcher{searchFor}) == searchIn.begin() + 5);
+	
+	//A predicate which is not the equality can not use the table
+	auto findCaseInsensitive = [](const auto& haystack, const auto& pattern) constexpr noexcept {
+			const constexprStd::boyer_moore_horspool_searcher searcher{pattern.begin(), pattern.end(),
+			                                                           std::hash<char>{}, CaseInsensitiveEqual{}};
+			const auto result = searcher(haystack.begin(), haystack.end());
+			return std::pair{result.first - haystack.begin(), result.second - haystack.begin()};
+		};
+	static_assert(findCaseInsensitive(text, "EXAMPLE"sv) == std::pair{17L, 24L});
+	static_assert(findCaseInsensitive(text, "The Searcher"sv) == std::pair{41L, 53L});
+	QVERIFY(compareCaseInsensitiveSearch<constexprStd::boyer_moore_horspool_searcher>());
+	
+	auto makeSearcher = [](const auto patFirst, const auto patLast) {
+			return constexprStd::boyer_moore_horspool_searcher{patFirst, patLast};
+		};
+	compareSearcher<char>(makeSearcher, 2);
+	compareSearcher<unsigned char>(makeSearcher, 256);
+	compareSearcher<int>(makeSearcher, 3);
+	compareSearcher<int>(makeSearcher, 200);
+	return;
+}
+
+void TestConstexprStd::testBoyerMooreSearcher(void) const noexcept {
+	auto find = [](const auto& haystack, const auto& pattern) constexpr noexcept {
+			const constexprStd::boyer_moore_searcher searcher{pattern.begin(), pattern.end()};
+			const auto result = searcher(haystack.begin(), haystack.end());
+			return std::pair{result.first - haystack.begin(), result.second - haystack.begin()};
+		};
+	
+	using namespace std::string_view_literals;
+	constexpr auto text = "here is a simple example, an example for the searcher"sv;
+	static_assert(find(text, "example"sv) == std::pair{17L, 24L});
+	static_assert(find(text, "searcher"sv) == std::pair{45L, 53L});
+	static_assert(find(text, "here"sv) == std::pair{0L, 4L});
+	static_assert(find(text, "examples"sv) == std::pair{53L, 53L});
+	static_assert(find(text, ""sv) == std::pair{0L, 0L});
+	static_assert(find(""sv, "x"sv) == std::pair{0L, 0L});
+	
+	//Periodic patterns, where the good suffix rule is needed for long shifts
+	static_assert(find("abababababababcababababababababc"sv, "ababababc"sv) == std::pair{6L, 15L});
+	static_assert(find("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"sv, "aaaab"sv) == std::pair{27L, 32L});
+	static_assert(find("baaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"sv, "baaaa"sv) == std::pair{0L, 5L});
+	static_assert(find("abcabdabcabcabdabcabd"sv, "abcabd"sv) == std::pair{0L, 6L});
+	static_assert(find("abcabcabdabcabd"sv, "abcabd"sv) == std::pair{3L, 9L});
+	
+	constexpr std::array ints{1, 2, 3, 1000, 2, 3, 1000, 2, 3, 1000, 5};
+	static_assert(find(ints, std::array{2, 3, 1000, 5}) == std::pair{7L, 11L});
+	static_assert(find(ints, std::array{1000, 1000}) == std::pair{11L, 11L});
+	
+	//Longer than the good suffix window
+	constexpr auto longFind{[find](void) constexpr noexcept {
+			std::array<int, 1000> haystack{};
+			std::array<int, 400> pattern{};
+			for ( std::size_t i = 0; i < haystack.size(); ++i ) {
+				haystack[i] = static_cast<int>(i % 3 == 0 && i != 300);
+			} //for ( std::size_t i = 0; i < haystack.size(); ++i )
+			for ( std::size_t i = 0; i < pattern.size(); ++i ) {
+				pattern[i] = static_cast<int>(i % 3 == 0);
+			} //for ( std::size_t i = 0; i < pattern.size(); ++i )
+			return find(haystack, pattern);
+		}()};
+	static_assert(longFind == std::pair{303L, 703L});
+	
+	//A searcher for a fixed pattern can be a constant
+	constexpr auto markerText = "some text <marker> more text"sv;
+	static_assert(constexprStd::search(markerText, globalSearcher) == markerText.begin() + 10);
+	
+	//A predicate which is not the equality can not use the bad character table
+	auto findCaseInsensitive = [](const auto& haystack, const auto& pattern) constexpr noexcept {
+			const constexprStd::boyer_moore_searcher searcher{pattern.begin(), pattern.end(), std::hash<char>{},
+			                                                  CaseInsensitiveEqual{}};
+			const auto result = searcher(haystack.begin(), haystack.end());
+			return std::pair{result.first - haystack.begin(), result.second - haystack.begin()};
+		};
+	static_assert(findCaseInsensitive(text, "EXAMPLE"sv) == std::pair{17L, 24L});
+	static_assert(findCaseInsensitive(text, "The Searcher"sv) == std::pair{41L, 53L});
+	QVERIFY(compareCaseInsensitiveSearch<constexprStd::boyer_moore_searcher>());
+	
+	auto makeSearcher = [](const auto patFirst, const auto patLast) {
+			return constexprStd::boyer_moore_searcher{patFirst, patLast};
+		};
+	compareSearcher<char>(makeSearcher, 2);
+	compareSearcher<unsigned char>(makeSearcher, 256);
+	compareSearcher<int>(makeSearcher, 3);
+	compareSearcher<int>(makeSearcher, 200);
+	return;
+}
+
+void TestConstexprStd::testTwoWaySearcher(void) const noexcept {
+	auto find = [](const auto& haystack, const auto& pattern) constexpr noexcept {
+			const constexprStd::two_way_searcher searcher{pattern.begin(), pattern.end()};
+			const auto result = searcher(haystack.begin(), haystack.end());
+			return std::pair{result.first - haystack.begin(), result.second - haystack.begin()};
+		};
+	
+	using namespace std::string_view_literals;
+	constexpr auto text = "here is a simple example, an example for the searcher"sv;
+	static_assert(find(text, "example"sv) == std::pair{17L, 24L});
+	static_assert(find(text, "searcher"sv) == std::pair{45L, 53L});
+	static_assert(find(text, "here"sv) == std::pair{0L, 4L});
+	static_assert(find(text, "examples"sv) == std::pair{53L, 53L});
+	static_assert(find(text, ""sv) == std::pair{0L, 0L});
+	static_assert(find(""sv, "x"sv) == std::pair{0L, 0L});
+	
+	//Periodic patterns, where the memory of the matched left part is used
+	static_assert(find("abababababababcababababababababc"sv, "ababababc"sv) == std::pair{6L, 15L});
+	static_assert(find("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"sv, "aaaab"sv) == std::pair{27L, 32L});
+	static_assert(find("baaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"sv, "baaaa"sv) == std::pair{0L, 5L});
+	static_assert(find("abcabcabdabcabd"sv, "abcabd"sv) == std::pair{3L, 9L});
+	static_assert(find("zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzza"sv, "zza"sv) == std::pair{29L, 32L});
+	
+	constexpr std::array ints{1, 2, 3, 1000, 2, 3, 1000, 2, 3, 1000, 5};
+	static_assert(find(ints, std::array{2, 3, 1000, 5}) == std::pair{7L, 11L});
+	static_assert(find(ints, std::array{1000, 1000}) == std::pair{11L, 11L});
+	
+	auto makeSearcher = [](const auto patFirst, const auto patLast) {
+			return constexprStd::two_way_searcher{patFirst, patLast};
+		};
+	compareSearcher<char>(makeSearcher, 2);
+	compareSearcher<unsigned char>(makeSearcher, 256);
+	compareSearcher<int>(makeSearcher, 3);
+	compareSearcher<int>(makeSearcher, 200);
+	
+	//The default searcher uses it for long patterns
+	auto makeDefaultSearcher = [](const auto patFirst, const auto patLast) {
+			return constexprStd::default_searcher{patFirst, patLast};
+		};
+	compareSearcher<char>(makeDefaultSearcher, 2);
+	compareSearcher<int>(makeDefaultSearcher, 3);
+	return;
+}
+
+void TestConstexprStd::testAhoCorasickSearcher(void) const noexcept {
+	using Match = std::tuple<std::size_t, long, long>;
+	auto reports = [](const auto& searcher, const auto& text, const auto& expected) constexpr noexcept {
+			std::size_t count = 0;
+			bool equal = true;
+			searcher(text, [&](const std::size_t pattern, const auto first, const auto last) {
+					equal = equal && count < expected.size() &&
+					        expected[count] == Match{pattern, first - text.begin(), last - text.begin()};
+					++count;
+					return;
+				});
+			return equal && count == expected.size();
+		};
+	
+	using namespace std::string_view_literals;
+	static_assert(reports(globalKeywordSearcher, "ushers"sv,
+	                      std::array{Match{1, 1, 4}, Match{0, 2, 4}, Match{3, 2, 6}}));
+	static_assert(reports(globalKeywordSearcher, "nothing"sv, std::array<Match, 0>{}));
+	static_assert(reports(globalKeywordSearcher, ""sv, std::array<Match, 0>{}));
+	static_assert(constexprStd::search("ushers"sv, globalKeywordSearcher) == "ushers"sv.begin() + 1);
+	static_assert(globalKeywordSearcher("hishe"sv) == std::pair{"hishe"sv.begin(), "hishe"sv.begin() + 3});
+	static_assert(globalKeywordSearcher("xyz"sv) == std::pair{"xyz"sv.end(), "xyz"sv.end()});
+	
+	//Empty patterns are ignored, equal ones are reported with the first index, patterns may contain each other
+	constexpr std::string_view nested[]{"aaa", "", "a", "aa", "a"};
+	constexpr constexprStd::aho_corasick_searcher<char, 4> nestedSearcher{nested};
+	static_assert(reports(nestedSearcher, "aaa"sv, std::array{Match{2, 0, 1}, Match{3, 0, 2}, Match{2, 1, 2},
+	                                                          Match{0, 0, 3}, Match{3, 1, 3}, Match{2, 2, 3}}));
+	
+	//Other elements are looked up by binary search
+	constexpr std::array<std::array<int, 2>, 3> intPatterns{{{1000, 7}, {7, 1000}, {-5, 1000}}};
+	constexpr constexprStd::aho_corasick_searcher<int, 8> intSearcher{intPatterns};
+	constexpr std::array ints{3, 1000, 7, 1000, 7, -5, 1000};
+	static_assert(reports(intSearcher, ints, std::array{Match{0, 1, 3}, Match{1, 2, 4}, Match{0, 3, 5},
+	                                                    Match{2, 5, 7}}));
+	
+	//A wider text is not truncated to the bytes of the table, U+0141 and U+0142 end with the bytes of 'A' and 'B'
+	constexpr std::string_view letters[]{"A", "AB"};
+	constexpr constexprStd::aho_corasick_searcher<char, 4> letterSearcher{letters};
+	static_assert(reports(letterSearcher, u"Łxyz"sv, std::array<Match, 0>{}));
+	static_assert(reports(letterSearcher, u"Ał"sv, std::array{Match{0, 0, 1}}));
+	static_assert(reports(letterSearcher, u"xAB"sv, std::array{Match{0, 1, 2}, Match{1, 1, 3}}));
+	
+	//Compare the matches on random texts with the ones of std::search for every pattern
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> element{'a', 'c'};
+	std::uniform_int_distribution<std::size_t> patternLength{1, 6};
+	auto randomString = [&gen,&element](const std::size_t length) {
+			std::string ret(length, '\0');
+			for ( char& c : ret ) {
+				c = static_cast<char>(element(gen));
+			} //for ( char& c : ret )
+			return ret;
+		};
+	
+	for ( int i = 0; i < 50; ++i ) {
+		std::vector<std::string> patterns(30);
+		for ( auto& pattern : patterns ) {
+			pattern = randomString(patternLength(gen));
+		} //for ( auto& pattern : patterns )
+		const std::string text = randomString(400);
+		
+		std::vector<std::tuple<std::ptrdiff_t, std::ptrdiff_t, std::size_t>> expected, found;
+		for ( std::size_t pattern = 0; pattern < patterns.size(); ++pattern ) {
+			if ( std::find(patterns.begin(), patterns.begin() + static_cast<std::ptrdiff_t>(pattern),
+			               patterns[pattern]) != patterns.begin() + static_cast<std::ptrdiff_t>(pattern) ) {
+				continue;
+			} //if ( std::find(patterns.begin(), patterns.begin() + pattern, patterns[pattern]) != ... )
+			
+			const auto length = static_cast<std::ptrdiff_t>(patterns[pattern].size());
+			for ( auto pos = text.begin(); (pos = std::search(pos, text.end(), patterns[pattern].begin(),
+			                                                  patterns[pattern].end())) != text.end(); ++pos ) {
+				expected.emplace_back(pos - text.begin() + length, length, pattern);
+			} //for ( auto pos = text.begin(); (pos = std::search(...)) != text.end(); ++pos )
+		} //for ( std::size_t pattern = 0; pattern < patterns.size(); ++pattern )
+		
+		const constexprStd::aho_corasick_searcher<char, 256> searcher{patterns};
+		searcher(text, [&found,&text](const std::size_t pattern, const auto first, const auto last) {
+				found.emplace_back(last - text.begin(), last - first, pattern);
+				return;
+			});
+		
+		//Reported by their end and then from the longest to the shortest
+		std::sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) noexcept {
+				return std::tuple{std::get<0>(lhs), std::get<1>(rhs)} < std::tuple{std::get<0>(rhs), std::get<1>(lhs)};
+			});
+		QCOMPARE(found, expected);
+	} //for ( int i = 0; i < 50; ++i )
+	return;
+}
@@ -25,8 +25,14 @@
 
 #include "../test.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <random>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include <constexprStd/iterator>
 
@@ -111,5 +117,210 @@ void TestConstexprStd::testAllocator(void) const noexcept {
 	a.construct(secondThree, 5, 6);
 	QCOMPARE(secondThree->X, 5);
 	QCOMPARE(secondThree->Y, 6);
+	
+	//At runtime the position is computed from the address, pointers of the fallback allocation are not ours
+	constexprStd::allocator<int, 4096> big;
+	std::vector<int*> singles;
+	for ( int i = 0; i < 4096; ++i ) {
+		singles.push_back(big.allocate(1));
+	} //for ( int i = 0; i < 4096; ++i )
+	for ( std::size_t i = 0; i < singles.size(); ++i ) {
+		QCOMPARE(constexprStd::distance(singles[0], singles[i]), static_cast<std::ptrdiff_t>(i));
+		QCOMPARE(big.getPointer(singles[i], 0), singles[i]);
+	} //for ( std::size_t i = 0; i < singles.size(); ++i )
+	
+	int *fallback = big.allocate(2);
+	QVERIFY(fallback < singles.front() || fallback > singles.back());
+	QCOMPARE(big.fallbackAllocations(), std::size_t{1});
+	QCOMPARE(big.liveSlots(), std::size_t{4096});
+	QCOMPARE(big.getPointer(fallback, 1), fallback + 1);
+	big.deallocate(fallback, 2);
+	
+	big.deallocate(singles[100], 1);
+	big.deallocate(singles[4095], 1);
+	QCOMPARE(big.allocate(1), singles[100]);
+	QCOMPARE(big.allocate(1), singles[4095]);
+	
+	//The free runs are searched a word of the bitmap at a time, they may span several words
+	auto runs = [](void) constexpr noexcept {
+			constexprStd::allocator<int, 200> words;
+			int *begin  = words.allocate(60);
+			int *middle = words.allocate(10);
+			int *end    = words.allocate(60);
+			words.deallocate(middle, 10);
+			int *crossing = words.allocate(20);
+			int *refill   = words.allocate(10);
+			int *last     = words.allocate(50);
+			return std::tuple{constexprStd::distance(begin, end), constexprStd::distance(begin, crossing),
+			                  constexprStd::distance(begin, refill), constexprStd::distance(begin, last)};
+		};
+	static_assert(runs() == std::tuple{70, 130, 60, 150});
+	
+	//An empty allocation does not use a slot, but also does not fall back, not even if all slots are used
+	auto zero = [](void) constexpr noexcept {
+			constexprStd::allocator<int, 2> tiny;
+			int *none = tiny.allocate(0);
+			int *both = tiny.allocate(2);
+			int *full = tiny.allocate(0);
+			const auto ret = std::tuple{tiny.liveSlots(), tiny.fallbackAllocations(), none == both};
+			tiny.deallocate(full, 0);
+			tiny.deallocate(none, 0);
+			tiny.deallocate(both, 2);
+			return std::tuple_cat(ret, std::tuple{tiny.liveSlots(), tiny.largestFreeRun()});
+		};
+	static_assert(zero() == std::tuple{std::size_t{2}, std::size_t{0}, true, std::size_t{0}, std::size_t{2}});
+	
+	auto stats = [](void) constexpr noexcept {
+			constexprStd::allocator<int, 200> counted;
+			constexprStd::allocator<int, 128> whole;
+			const bool empty = counted.largestFreeRun() == 200 && whole.largestFreeRun() == 128 &&
+			                   counted.fragmentation() < 1e-9 && counted.peakSlots() == 0;
+			
+			int *front  = counted.allocate(60);
+			int *middle = counted.allocate(10);
+			int *back   = counted.allocate(60);
+			counted.deallocate(middle, 10);
+			const double fragmentation = counted.fragmentation();
+			const auto used = std::tuple{counted.liveSlots(), counted.peakSlots(), counted.fallbackAllocations(),
+			                             counted.largestFreeRun(), fragmentation > 0.124 && fragmentation < 0.126};
+			
+			int *rest = counted.allocate(70);
+			int *gap  = counted.allocate(10);
+			const bool full = counted.largestFreeRun() == 0 && counted.fragmentation() < 1e-9;
+			counted.deallocate(front, 60);
+			counted.deallocate(gap, 10);
+			counted.deallocate(back, 60);
+			counted.deallocate(rest, 70);
+			return std::tuple{empty, used, full, counted.liveSlots(), counted.peakSlots()};
+		};
+	constexpr std::tuple measured{std::size_t{120}, std::size_t{130}, std::size_t{0}, std::size_t{70}, true};
+	static_assert(stats() == std::tuple{true, measured, true, std::size_t{0}, std::size_t{200}});
+	
+	//Compare with a first fit on a plain bitmap, the first slot is the base for the positions
+	constexprStd::allocator<int, 300> fit;
+	int *const base = fit.allocate(1);
+	std::vector<bool> used(300);
+	used[0] = true;
+	std::vector<std::pair<std::size_t, std::size_t>> allocations;
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<std::size_t> size{1, 70};
+	std::size_t peak = 1;
+	for ( int i = 0; i < 2000; ++i ) {
+		if ( !allocations.empty() && gen() % 2 ) {
+			const auto index = gen() % allocations.size();
+			const auto [pos, n] = allocations[index];
+			fit.deallocate(base + pos, n);
+			std::fill_n(used.begin() + static_cast<std::ptrdiff_t>(pos), n, false);
+			allocations.erase(allocations.begin() + static_cast<std::ptrdiff_t>(index));
+		} //if ( !allocations.empty() && gen() % 2 )
+		else {
+			const std::size_t n = size(gen);
+			std::size_t end = 0, run = 0;
+			for ( ; end < used.size() && run < n; ++end ) {
+				run = used[end] ? 0 : run + 1;
+			} //for ( ; end < used.size() && run < n; ++end )
+			
+			int *const ptr = fit.allocate(n);
+			if ( run < n ) {
+				QVERIFY(std::less<>{}(ptr, base) || !std::less<>{}(ptr, base + 300));
+				fit.deallocate(ptr, n);
+			} //if ( run < n )
+			else {
+				QCOMPARE(ptr - base, static_cast<std::ptrdiff_t>(end - n));
+				std::fill_n(used.begin() + static_cast<std::ptrdiff_t>(end - n), n, true);
+				allocations.emplace_back(end - n, n);
+			} //else -> if ( run < n )
+		} //else -> if ( !allocations.empty() && gen() % 2 )
+		
+		std::size_t largest = 0, run = 0, live = 0;
+		for ( const bool slot : used ) {
+			run      = slot ? 0 : run + 1;
+			largest  = std::max(largest, run);
+			live    += slot;
+		} //for ( const bool slot : used )
+		peak = std::max(peak, live);
+		QCOMPARE(fit.largestFreeRun(), largest);
+		QCOMPARE(fit.liveSlots(), live);
+		QCOMPARE(fit.peakSlots(), peak);
+	} //for ( int i = 0; i < 2000; ++i )
+	return;
+}
+
+void TestConstexprStd::testPoolAllocator(void) const noexcept {
+	auto l = [](void) constexpr noexcept {
+			constexprStd::pool_allocator<int, 4> a;
+			int *first  = a.allocate(1);
+			int *second = a.allocate(1);
+			int *third  = a.allocate(1);
+			auto t1 = std::tuple{constexprStd::distance(first, second), constexprStd::distance(first, third)};
+			
+			//The last released slot is the next one handed out
+			a.deallocate(first, 1);
+			a.deallocate(third, 1);
+			int *fourth = a.allocate(1);
+			int *fifth  = a.allocate(1);
+			int *sixth  = a.allocate(1);
+			auto t2 = std::tuple{fourth == third, fifth == first, constexprStd::distance(first, sixth)};
+			
+			a.construct(sixth, 5);
+			auto t3 = std::tuple{*sixth, a.getPointer(first, 2) == third};
+			return std::tuple_cat(t1, t2, t3);
+		};
+	static_assert(l() == std::tuple{1, 2, true, true, 3, 5, true});
+	
+	//An empty allocation does not use a slot, but also does not fall back, not even if all slots are used
+	auto zero = [](void) constexpr noexcept {
+			constexprStd::pool_allocator<int, 2> tiny;
+			int *none   = tiny.allocate(0);
+			int *first  = tiny.allocate(1);
+			int *second = tiny.allocate(1);
+			int *full   = tiny.allocate(0);
+			tiny.deallocate(full, 0);
+			tiny.deallocate(none, 0);
+			tiny.deallocate(second, 1);
+			const bool reused = tiny.allocate(1) == second;
+			tiny.deallocate(first, 1);
+			return std::tuple{none == first, constexprStd::distance(first, second), reused};
+		};
+	static_assert(zero() == std::tuple{true, 1, true});
+	
+	//Churn with random releases, the slots stay distinct and only a full pool falls back
+	constexprStd::pool_allocator<int, 500> pool;
+	int *const base = pool.allocate(1);
+	std::vector<int*> live{base};
+	std::vector<bool> used(500);
+	used[0] = true;
+	std::mt19937 gen{std::random_device{}()};
+	for ( int i = 0; i < 100000; ++i ) {
+		if ( live.size() > 1 && gen() % 2 ) {
+			const auto index = 1 + gen() % (live.size() - 1);
+			int *const ptr = live[index];
+			if ( !std::less<>{}(ptr, base) && std::less<>{}(ptr, base + 500) ) {
+				used[static_cast<std::size_t>(ptr - base)] = false;
+			} //if ( !std::less<>{}(ptr, base) && std::less<>{}(ptr, base + 500) )
+			pool.deallocate(ptr, 1);
+			live.erase(live.begin() + static_cast<std::ptrdiff_t>(index));
+		} //if ( live.size() > 1 && gen() % 2 )
+		else {
+			int *const ptr = pool.allocate(1);
+			const bool full = std::find(used.begin(), used.end(), false) == used.end();
+			const bool ours = !std::less<>{}(ptr, base) && std::less<>{}(ptr, base + 500);
+			QCOMPARE(ours, !full);
+			if ( ours ) {
+				QVERIFY(!used[static_cast<std::size_t>(ptr - base)]);
+				used[static_cast<std::size_t>(ptr - base)] = true;
+			} //if ( ours )
+			live.push_back(ptr);
+		} //else -> if ( live.size() > 1 && gen() % 2 )
+	} //for ( int i = 0; i < 100000; ++i )
+	
+	for ( int *ptr : live ) {
+		pool.deallocate(ptr, 1);
+	} //for ( int *ptr : live )
+	
+	//More than one element is never taken from the pool
+	int *const many = pool.allocate(2);
+	QVERIFY(std::less<>{}(many, base) || !std::less<>{}(many, base + 500));
+	pool.deallocate(many, 2);
 	return;
 }
@@ -0,0 +1,269 @@
+/**
+ ** This file is part of the constexprStd project.
+ ** Copyright 2017 Björn Schäpers <bjoern@hazardy.de>.
+ **
+ ** This program is free software: you can redistribute it and/or modify
+ ** it under the terms of the GNU Lesser General Public License as
+ ** published by the Free Software Foundation, either version 3 of the
+ ** License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ ** GNU Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public License
+ ** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/**
+ * @file
+ * @brief Checks constexprStd/numeric for self-containment and contains the tests.
+ */
+
+#include <constexprStd/numeric>
+
+#include "../test.hpp"
+#include "test_container.hpp"
+
+#include <array>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <constexprStd/algorithm>
+
+void TestConstexprStd::testIota(void) const noexcept {
+	constexpr auto l = [](void) constexpr noexcept {
+			std::array<int, 10> ret{};
+			constexprStd::iota(ret, 1);
+			return ret;
+		};
+	static_assert(constexprStd::equal(l(), TestContainer{}));
+	
+	std::forward_list<int> s(10), c(10);
+	         std::iota(s.begin(), s.end(), -3);
+	constexprStd::iota(c.begin(), c.end(), -3);
+	QVERIFY(s == c);
+	return;
+}
+
+void TestConstexprStd::testAccumulate(void) const noexcept {
+	constexpr TestContainer c;
+	
+	static_assert(constexprStd::accumulate(c, 0) == 55);
+	static_assert(constexprStd::accumulate(c.begin(), c.end(), 1, std::multiplies<>{}) == 3628800);
+	static_assert(constexprStd::accumulate(c.begin(), c.begin(), 7) == 7);
+	
+	//Not commutative, so the order matters
+	auto l = [](const long long sum, const int i) constexpr noexcept { return sum * 10 + i; };
+	static_assert(constexprStd::accumulate(c, 0LL, l) == 1234567900LL);
+	QCOMPARE(constexprStd::accumulate(c, 0LL, l), std::accumulate(c.begin(), c.end(), 0LL, l));
+	return;
+}
+
+void TestConstexprStd::testInnerProduct(void) const noexcept {
+	constexpr TestContainer c1, c2{2, 0, 1, 0, 1, 0, 1, 0, 1, 1};
+	
+	static_assert(constexprStd::inner_product(c1, c2.begin(), 0) == 2 + 3 + 5 + 7 + 9 + 10);
+	static_assert(constexprStd::inner_product(c1.begin(), c1.end(), c2.begin(), 0, std::plus<>{},
+	                                          std::not_equal_to<>{}) == 10);
+	QCOMPARE(constexprStd::inner_product(c1.begin(), c1.end(), c2.begin(), 5),
+	                  std::inner_product(c1.begin(), c1.end(), c2.begin(), 5));
+	return;
+}
+
+void TestConstexprStd::testAdjacentDifference(void) const noexcept {
+	constexpr std::array<int, 6> a{1, 4, 9, 16, 25, 36};
+	
+	constexpr auto l = [a](void) constexpr noexcept {
+			std::array<int, 6> ret{};
+			constexprStd::adjacent_difference(a, ret.begin());
+			return ret;
+		};
+	static_assert(constexprStd::equal(l(), std::array<int, 6>{1, 3, 5, 7, 9, 11}));
+	
+	//In place
+	constexpr auto inPlace = [a](void) constexpr noexcept {
+			auto ret{a};
+			constexprStd::adjacent_difference(ret.begin(), ret.end(), ret.begin(), std::plus<>{});
+			return ret;
+		};
+	static_assert(constexprStd::equal(inPlace(), std::array<int, 6>{1, 5, 13, 25, 41, 61}));
+	
+	std::vector<int> s, c;
+	         std::adjacent_difference(a.begin(), a.end(), std::back_inserter(s));
+	constexprStd::adjacent_difference(a.begin(), a.end(), std::back_inserter(c));
+	QVERIFY(s == c);
+	return;
+}
+
+void TestConstexprStd::testPartialSum(void) const noexcept {
+	constexpr TestContainer c;
+	
+	constexpr auto l = [c](void) constexpr noexcept {
+			std::array<int, 10> ret{};
+			constexprStd::partial_sum(c, ret.begin());
+			return ret;
+		};
+	static_assert(constexprStd::equal(l(), std::array<int, 10>{1, 3, 6, 10, 15, 21, 28, 36, 45, 55}));
+	
+	std::vector<int> s, v;
+	         std::partial_sum(c.begin(), c.end(), std::back_inserter(s), std::multiplies<>{});
+	constexprStd::partial_sum(c.begin(), c.end(), std::back_inserter(v), std::multiplies<>{});
+	QVERIFY(s == v);
+	return;
+}
+
+void TestConstexprStd::testReduce(void) const noexcept {
+	constexpr TestContainer c;
+	
+	static_assert(constexprStd::reduce(c) == 55);
+	static_assert(constexprStd::reduce(c.begin(), c.end()) == 55);
+	static_assert(constexprStd::reduce(c, 5) == 60);
+	static_assert(constexprStd::reduce(c.begin(), c.end(), 1LL, std::multiplies<>{}) == 3628800);
+	
+	//Large enough for the multiple accumulators and a remainder
+	constexpr auto sum = [](void) constexpr noexcept {
+			std::array<long long, 10003> a{};
+			constexprStd::iota(a, 1LL);
+			return constexprStd::reduce(a);
+		}();
+	static_assert(sum == 10003LL * 10004LL / 2);
+	
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 100};
+	std::uniform_int_distribution<int> element{-1000, 1000};
+	
+	std::vector<int> v;
+	std::forward_list<int> l;
+	for ( int i = 0; i < 50; ++i ) {
+		v.resize(static_cast<std::size_t>(elementCount(gen)));
+		std::generate(v.begin(), v.end(), [&](void) { return element(gen); });
+		l.assign(v.begin(), v.end());
+		
+		const auto expected = std::accumulate(v.begin(), v.end(), 0);
+		QCOMPARE(constexprStd::reduce(v), expected);
+		QCOMPARE(constexprStd::reduce(l.begin(), l.end()), expected);
+	} //for ( int i = 0; i < 50; ++i )
+	return;
+}
+
+void TestConstexprStd::testExclusiveScan(void) const noexcept {
+	constexpr TestContainer c;
+	
+	constexpr auto l = [c](void) constexpr noexcept {
+			std::array<int, 10> ret{};
+			constexprStd::exclusive_scan(c, ret.begin(), 0);
+			return ret;
+		};
+	static_assert(constexprStd::equal(l(), std::array<int, 10>{0, 1, 3, 6, 10, 15, 21, 28, 36, 45}));
+	
+	//In place
+	constexpr auto inPlace = [c](void) constexpr noexcept {
+			auto ret{c};
+			constexprStd::exclusive_scan(ret.begin(), ret.end(), ret.begin(), 1, std::multiplies<>{});
+			return ret;
+		};
+	static_assert(constexprStd::equal(inPlace(), std::array<int, 10>{1, 1, 2, 6, 24, 120, 720, 5040, 40320, 362880}));
+	
+	std::vector<int> s, v;
+	         std::exclusive_scan(c.begin(), c.end(), std::back_inserter(s), 3);
+	constexprStd::exclusive_scan(c.begin(), c.end(), std::back_inserter(v), 3);
+	QVERIFY(s == v);
+	return;
+}
+
+void TestConstexprStd::testInclusiveScan(void) const noexcept {
+	constexpr TestContainer c;
+	
+	constexpr auto l = [c](void) constexpr noexcept {
+			std::array<int, 10> ret{};
+			constexprStd::inclusive_scan(c, ret.begin());
+			return ret;
+		};
+	static_assert(constexprStd::equal(l(), std::array<int, 10>{1, 3, 6, 10, 15, 21, 28, 36, 45, 55}));
+	
+	constexpr auto withInit = [c](void) constexpr noexcept {
+			std::array<int, 10> ret{};
+			constexprStd::inclusive_scan(c, ret.begin(), std::plus<>{}, 10);
+			return ret;
+		};
+	static_assert(constexprStd::equal(withInit(), std::array<int, 10>{11, 13, 16, 20, 25, 31, 38, 46, 55, 65}));
+	
+	std::vector<int> s, v;
+	         std::inclusive_scan(c.begin(), c.end(), std::back_inserter(s), std::multiplies<>{});
+	constexprStd::inclusive_scan(c.begin(), c.end(), std::back_inserter(v), std::multiplies<>{});
+	QVERIFY(s == v);
+	return;
+}
+
+void TestConstexprStd::testTransformReduce(void) const noexcept {
+	constexpr TestContainer c1, c2{2, 0, 1, 0, 1, 0, 1, 0, 1, 1};
+	auto square = [](const int i) constexpr noexcept { return i * i; };
+	
+	static_assert(constexprStd::transform_reduce(c1, c2.begin(), 0) == 2 + 3 + 5 + 7 + 9 + 10);
+	static_assert(constexprStd::transform_reduce(c1.begin(), c1.end(), c2.begin(), 0, std::plus<>{},
+	                                             std::not_equal_to<>{}) == 10);
+	static_assert(constexprStd::transform_reduce(c1, 0, std::plus<>{}, square) == 385);
+	
+	std::mt19937 gen{std::random_device{}()};
+	std::uniform_int_distribution<int> elementCount{0, 100};
+	std::uniform_int_distribution<int> element{-1000, 1000};
+	
+	std::vector<int> v1, v2;
+	std::forward_list<int> l;
+	for ( int i = 0; i < 50; ++i ) {
+		v1.resize(static_cast<std::size_t>(elementCount(gen)));
+		v2.resize(v1.size());
+		std::generate(v1.begin(), v1.end(), [&](void) { return element(gen); });
+		std::generate(v2.begin(), v2.end(), [&](void) { return element(gen); });
+		l.assign(v2.begin(), v2.end());
+		
+		const auto expected = std::inner_product(v1.begin(), v1.end(), v2.begin(), 0LL);
+		QCOMPARE(constexprStd::transform_reduce(v1, v2.begin(), 0LL), expected);
+		QCOMPARE(constexprStd::transform_reduce(v1.begin(), v1.end(), l.begin(), 0LL), expected);
+		QCOMPARE(constexprStd::transform_reduce(v1.begin(), v1.end(), 0LL, std::plus<>{}, square),
+		         std::inner_product(v1.begin(), v1.end(), v1.begin(), 0LL));
+	} //for ( int i = 0; i < 50; ++i )
+	return;
+}
+
+void TestConstexprStd::testTransformExclusiveScan(void) const noexcept {
+	constexpr TestContainer c;
+	auto square = [](const int i) constexpr noexcept { return i * i; };
+	
+	constexpr auto l = [c,square](void) constexpr noexcept {
+			std::array<int, 10> ret{};
+			constexprStd::transform_exclusive_scan(c, ret.begin(), 0, std::plus<>{}, square);
+			return ret;
+		};
+	static_assert(constexprStd::equal(l(), std::array<int, 10>{0, 1, 5, 14, 30, 55, 91, 140, 204, 285}));
+	
+	std::vector<int> s, v;
+	         std::transform_exclusive_scan(c.begin(), c.end(), std::back_inserter(s), 3, std::plus<>{}, square);
+	constexprStd::transform_exclusive_scan(c.begin(), c.end(), std::back_inserter(v), 3, std::plus<>{}, square);
+	QVERIFY(s == v);
+	return;
+}
+
+void TestConstexprStd::testTransformInclusiveScan(void) const noexcept {
+	constexpr TestContainer c;
+	auto square = [](const int i) constexpr noexcept { return i * i; };
+	
+	constexpr auto l = [c,square](void) constexpr noexcept {
+			std::array<int, 10> ret{};
+			constexprStd::transform_inclusive_scan(c, ret.begin(), std::plus<>{}, square);
+			return ret;
+		};
+	static_assert(constexprStd::equal(l(), std::array<int, 10>{1, 5, 14, 30, 55, 91, 140, 204, 285, 385}));
+	
+	std::vector<int> s, v;
+	         std::transform_inclusive_scan(c.begin(), c.end(), std::back_inserter(s), std::plus<>{}, square, 3);
+	constexprStd::transform_inclusive_scan(c.begin(), c.end(), std::back_inserter(v), std::plus<>{}, square, 3);
+	QVERIFY(s == v);
+	return;
+}
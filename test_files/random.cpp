@@ -0,0 +1,189 @@
+/**
+ ** This file is part of the constexprStd project.
+ ** Copyright 2017 Björn Schäpers <bjoern@hazardy.de>.
+ **
+ ** This program is free software: you can redistribute it and/or modify
+ ** it under the terms of the GNU Lesser General Public License as
+ ** published by the Free Software Foundation, either version 3 of the
+ ** License, or (at your option) any later version.
+ **
+ ** This program is distributed in the hope that it will be useful,
+ ** but WITHOUT ANY WARRANTY; without even the implied warranty of
+ ** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ ** GNU Lesser General Public License for more details.
+ **
+ ** You should have received a copy of the GNU Lesser General Public License
+ ** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/**
+ * @file
+ * @brief Checks constexprStd/random for self-containment and contains the tests.
+ */
+
+#include <constexprStd/random>
+
+#include "../test.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include <constexprStd/algorithm>
+
+void TestConstexprStd::testXoshiro256StarStar(void) const noexcept {
+	constexpr auto first{[](void) constexpr noexcept {
+			constexprStd::xoshiro256starstar g{42};
+			std::array<std::uint64_t, 4> ret{};
+			for ( auto& r : ret ) {
+				r = g();
+			} //for ( auto& r : ret )
+			return ret;
+		}()};
+	constexpr std::array<std::uint64_t, 4> expected{0x15780B2E0C2EC716, 0x6104D9866D113A7E, 0xAE17533239E499A1,
+	                                                0xECB8AD4703B360A1};
+	static_assert(constexprStd::equal(first, expected));
+	
+	static_assert(constexprStd::xoshiro256starstar::min() == 0);
+	static_assert(constexprStd::xoshiro256starstar::max() == std::numeric_limits<std::uint64_t>::max());
+	static_assert(constexprStd::xoshiro256starstar{} == constexprStd::xoshiro256starstar{});
+	static_assert(constexprStd::xoshiro256starstar{} != constexprStd::xoshiro256starstar{42});
+	
+	constexpr bool discardIsCalling{[](void) constexpr noexcept {
+			constexprStd::xoshiro256starstar g1{7}, g2{7};
+			g1.discard(100);
+			for ( int i = 0; i < 100; ++i ) {
+				g2();
+			} //for ( int i = 0; i < 100; ++i )
+			
+			g2.seed();
+			g1.seed();
+			return g1 == g2 && g1 == constexprStd::xoshiro256starstar{};
+		}()};
+	static_assert(discardIsCalling);
+	
+	constexprStd::xoshiro256starstar g{42};
+	for ( const auto e : expected ) {
+		QCOMPARE(g(), e);
+	} //for ( const auto e : expected )
+	return;
+}
+
+void TestConstexprStd::testPcg32(void) const noexcept {
+	//The values of the reference implementation's demo
+	constexpr auto first{[](void) constexpr noexcept {
+			constexprStd::pcg32 g{42, 54};
+			std::array<std::uint32_t, 6> ret{};
+			for ( auto& r : ret ) {
+				r = g();
+			} //for ( auto& r : ret )
+			return ret;
+		}()};
+	constexpr std::array<std::uint32_t, 6> expected{0xA15C02B7, 0x7B47F409, 0xBA1D3330, 0x83D2F293, 0xBFA4784B,
+	                                                0xCBED606E};
+	static_assert(constexprStd::equal(first, expected));
+	
+	static_assert(constexprStd::pcg32::min() == 0);
+	static_assert(constexprStd::pcg32::max() == std::numeric_limits<std::uint32_t>::max());
+	static_assert(constexprStd::pcg32{} == constexprStd::pcg32{});
+	static_assert(constexprStd::pcg32{42, 54} != constexprStd::pcg32{42, 55});
+	
+	constexpr bool discardJumps{[](void) constexpr noexcept {
+			constexprStd::pcg32 g1{42, 54}, g2{42, 54};
+			g1.discard(3);
+			g2();
+			g2();
+			g2();
+			if ( g1 != g2 || g1() != 0x83D2F293 ) {
+				return false;
+			} //if ( g1 != g2 || g1() != 0x83D2F293 )
+			
+			//The period is 2^64, so a million steps take only about 40 operations
+			g1.discard(1'000'000);
+			g2.discard(999'999);
+			g2();
+			g2();
+			return g1 == g2;
+		}()};
+	static_assert(discardJumps);
+	
+	constexprStd::pcg32 g{42, 54};
+	for ( const auto e : expected ) {
+		QCOMPARE(g(), e);
+	} //for ( const auto e : expected )
+	return;
+}
+
+void TestConstexprStd::testUniformIntDistribution(void) const noexcept {
+	constexpr constexprStd::uniform_int_distribution<int> d1;
+	static_assert(d1.a() == 0);
+	static_assert(d1.b() == std::numeric_limits<int>::max());
+	static_assert(d1.min() == 0);
+	static_assert(d1 == constexprStd::uniform_int_distribution<int>{0});
+	static_assert(d1 != constexprStd::uniform_int_distribution<int>{0, 5});
+	static_assert(constexprStd::uniform_int_distribution<short>{-3, 7}.param() ==
+	              constexprStd::uniform_int_distribution<short>::param_type{-3, 7});
+	
+	//Every value of a small interval is hit and nothing outside of it
+	auto histogram = [](auto g, auto d) constexpr noexcept {
+			std::array<int, 12> ret{};
+			for ( int i = 0; i < 1200; ++i ) {
+				const auto value = d(g);
+				if ( value < -5 || value > 6 ) {
+					return std::array<int, 12>{};
+				} //if ( value < -5 || value > 6 )
+				++ret[static_cast<std::size_t>(value + 5)];
+			} //for ( int i = 0; i < 1200; ++i )
+			return ret;
+		};
+	constexpr auto h1 = histogram(constexprStd::pcg32{}, constexprStd::uniform_int_distribution<int>{-5, 6});
+	constexpr auto h2 = histogram(constexprStd::xoshiro256starstar{}, constexprStd::uniform_int_distribution<long>{-5, 6});
+	static_assert(constexprStd::none_of(h1, [](const int count) constexpr noexcept { return count == 0; }));
+	static_assert(constexprStd::none_of(h2, [](const int count) constexpr noexcept { return count == 0; }));
+	
+	//Full and degenerated ranges
+	constexpr bool extremes{[](void) constexpr noexcept {
+			constexprStd::pcg32 g;
+			constexprStd::uniform_int_distribution<long long> full{std::numeric_limits<long long>::min()};
+			constexprStd::uniform_int_distribution<std::uint64_t> wide{0, std::numeric_limits<std::uint64_t>::max() / 3};
+			constexprStd::uniform_int_distribution<int> single{17, 17};
+			bool highBitSeen = false, ret = true;
+			for ( int i = 0; i < 100; ++i ) {
+				full(g);
+				highBitSeen = highBitSeen || wide(g) > std::numeric_limits<std::uint32_t>::max();
+				ret = ret && single(g) == 17;
+			} //for ( int i = 0; i < 100; ++i )
+			return ret && highBitSeen;
+		}()};
+	static_assert(extremes);
+	
+	std::random_device rd;
+	constexprStd::xoshiro256starstar g64{(static_cast<std::uint64_t>(rd()) << 32) | rd()};
+	constexprStd::pcg32 g32{rd(), rd()};
+	std::minstd_rand gGeneric{rd()};
+	
+	auto checkUniform = [](auto& g, auto d) {
+			std::array<int, 6> counts{};
+			for ( int i = 0; i < 60000; ++i ) {
+				const auto value = d(g);
+				QVERIFY(value >= d.min() && value <= d.max());
+				++counts[static_cast<std::size_t>((value - d.min()) % 6)];
+			} //for ( int i = 0; i < 60000; ++i )
+			
+			//The standard deviation is about 91
+			for ( const int count : counts ) {
+				QVERIFY(count > 9400 && count < 10600);
+			} //for ( const int count : counts )
+			return;
+		};
+	
+	checkUniform(g64, constexprStd::uniform_int_distribution<int>{1, 6});
+	checkUniform(g32, constexprStd::uniform_int_distribution<int>{-6, -1});
+	checkUniform(gGeneric, constexprStd::uniform_int_distribution<int>{10, 15});
+	
+	//Needs more than one call of the generator
+	checkUniform(gGeneric, constexprStd::uniform_int_distribution<long long>{0, (1LL << 40) * 6 - 1});
+	checkUniform(g32, constexprStd::uniform_int_distribution<long long>{0, (1LL << 40) * 6 - 1});
+	return;
+}
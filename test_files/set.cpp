@@ -74,6 +74,28 @@ void TestConstexprStd::testSet(void) const noexcept {
 	
 	static_assert(l() == std::tuple{true, false, 1, 5, 8, 8, 12, 3, 3, 1, 0, true, false, 0});
 	
+	//The nodes can also come from a pool, which reuses the released ones
+	auto pool = [](void) constexpr noexcept {
+			constexprStd::set<int, 4, std::less<int>, constexprStd::pool_allocator> set;
+			int sum = 0;
+			for ( int round = 0; round < 20; ++round ) {
+				set.insert({round + 3, round + 1, round, round + 2});
+				sum += *set.begin();
+				set.clear();
+			} //for ( int round = 0; round < 20; ++round )
+			return sum;
+		};
+	static_assert(pool() == 190);
+	
+	//The statistics of the allocator tell how many of the N nodes were really needed
+	auto sizing = [](void) constexpr noexcept {
+			constexprStd::set<int, 16> set{9, 3, 7, 1, 5, 8, 2, 6, 4, 0};
+			set.erase(set.begin(), set.find(4));
+			const auto& alloc = set.get_allocator();
+			return std::tuple{alloc.liveSlots(), alloc.peakSlots(), alloc.fallbackAllocations()};
+		};
+	static_assert(sizing() == std::tuple{std::size_t{6}, std::size_t{10}, std::size_t{0}});
+	
 	int& instances = CountInstances<std::string>::Instances;
 	if ( instances != 0 ) {
 		QWARN("Had to reset CountInstances<std::string>::Instances");